@@ -0,0 +1,44 @@
+/*!
+ *  \file AuxTimeSeriesValue.h
+ *    \brief AuxKernel for setting a variable from time-series data
+ *    \details This file creates an auxiliary kernel that sets the value of an auxiliary variable
+ * from a column of a time-series data file through a TimeSeriesDataReader user object (e.g., for
+ * measured inlet temperatures). This can be used in place of TemporalStepFunction when the inputs
+ * come from experimental data.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "AuxKernel.h"
+#include "TimeSeriesDataReader.h"
+
+/// AuxTimeSeriesValue class inherits from AuxKernel
+class AuxTimeSeriesValue : public AuxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Standard MOOSE public constructor
+  AuxTimeSeriesValue(const InputParameters & parameters);
+
+protected:
+  /// Required MOOSE function override
+  virtual Real computeValue() override;
+
+private:
+  const TimeSeriesDataReader & _reader; ///< User object with the time-series data
+  const unsigned int _column;           ///< Index of the column for the value
+  Real _scale;                          ///< Factor to convert the data to the aux value
+};
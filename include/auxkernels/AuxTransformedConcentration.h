@@ -0,0 +1,43 @@
+/*!
+ *  \file AuxTransformedConcentration.h
+ *    \brief Auxiliary kernel to compute concentration from a transformed variable
+ *    \details This file creates an auxiliary kernel to compute the concentration C(w) from a
+ * species that is solved in a transformed variable w. This is used for output and to couple the
+ * concentration to objects that are not transformed.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "AuxKernel.h"
+#include "ConcentrationTransform.h"
+
+/// AuxTransformedConcentration class object inherits from AuxKernel object
+/** This class object gives the concentration C(w) of a species that is solved in a
+    transformed variable w, for output and for coupling to other objects. */
+class AuxTransformedConcentration : public AuxKernel, public ConcentrationTransform
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Standard MOOSE public constructor
+  AuxTransformedConcentration(const InputParameters & parameters);
+
+protected:
+  /// Required MOOSE function override
+  virtual Real computeValue() override;
+
+private:
+  const VariableValue & _transformed; ///< Variable for the transformed species (w)
+};
@@ -0,0 +1,52 @@
+/*!
+ *  \file ConstantAuxKernel.h
+ *    \brief Base AuxKernel for values that only depend on constant inputs
+ *    \details This file creates a base auxiliary kernel for values that only depend on fixed
+ * parameters and constant coupled inputs (e.g., geometric ratios of monoliths and fixed beds that
+ * only depend on the bulk porosity). The value is computed the first time the kernel is executed
+ * and all later executions are skipped, so the aux variable keeps the value that was computed
+ * (and stored in the solution) without evaluating it again at every step on every node.
+ *
+ *            A coupled input is always considered constant if it is a constant value. Coupled
+ *            auxiliary variables are only considered constant if the user sets the constant_inputs
+ *            parameter to true, since they may change in time (e.g., a porosity given by a
+ *            FunctionAux). If any input is not constant, the kernel is evaluated at every execution
+ *            like a normal AuxKernel.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "AuxKernel.h"
+
+/// ConstantAuxKernel class inherits from AuxKernel
+class ConstantAuxKernel : public AuxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Standard MOOSE public constructor
+  ConstantAuxKernel(const InputParameters & parameters);
+
+  /// MOOSE function override to skip the evaluation after the first execution
+  virtual void compute() override;
+
+protected:
+  /// Function to check if the given coupled input is constant
+  void checkConstantInput(const std::string & name);
+
+  const bool _constant_aux; ///< True if coupled auxiliary variables are treated as constant
+  bool _constant;           ///< True if all inputs are constant (compute only once)
+  int _first_step;          ///< Time step of the first execution
+};
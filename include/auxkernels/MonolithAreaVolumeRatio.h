@@ -21,10 +21,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// MonolithAreaVolumeRatio class inherits from AuxKernel
-class MonolithAreaVolumeRatio : public AuxKernel
+/// MonolithAreaVolumeRatio class inherits from ConstantAuxKernel
+class MonolithAreaVolumeRatio : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
@@ -20,10 +20,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// MonolithHydraulicDiameter class inherits from AuxKernel
-class MonolithHydraulicDiameter : public AuxKernel
+/// MonolithHydraulicDiameter class inherits from ConstantAuxKernel
+class MonolithHydraulicDiameter : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
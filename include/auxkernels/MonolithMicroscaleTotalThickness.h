@@ -38,10 +38,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// MonolithMicroscaleTotalThickness class inherits from AuxKernel
-class MonolithMicroscaleTotalThickness : public AuxKernel
+/// MonolithMicroscaleTotalThickness class inherits from ConstantAuxKernel
+class MonolithMicroscaleTotalThickness : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
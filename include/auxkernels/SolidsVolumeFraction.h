@@ -21,10 +21,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// SolidsVolumeFraction class inherits from AuxKernel
-class SolidsVolumeFraction : public AuxKernel
+/// SolidsVolumeFraction class inherits from ConstantAuxKernel
+class SolidsVolumeFraction : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
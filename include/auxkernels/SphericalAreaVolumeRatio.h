@@ -20,10 +20,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// SphericalAreaVolumeRatio class inherits from AuxKernel
-class SphericalAreaVolumeRatio : public AuxKernel
+/// SphericalAreaVolumeRatio class inherits from ConstantAuxKernel
+class SphericalAreaVolumeRatio : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
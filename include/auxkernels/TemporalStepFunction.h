@@ -26,6 +26,7 @@
 #pragma once
 
 #include "AuxKernel.h"
+#include "StepwiseInput.h"
 
 /// TemporalStepFunction class inherits from AuxKernel
 class TemporalStepFunction : public AuxKernel
@@ -50,5 +51,4 @@ private:
   std::vector<Real> _input_times; ///< Values for determining when to change aux
   std::vector<Real> _time_spans;  ///< Amount of time it take to change to new input value
   std::vector<Real> _slopes;      ///< Slopes between each subsequent aux
-  int index;                      ///< Index variable to keep track of location in vectors
 };
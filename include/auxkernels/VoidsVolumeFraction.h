@@ -41,10 +41,10 @@
 
 #pragma once
 
-#include "AuxKernel.h"
+#include "ConstantAuxKernel.h"
 
-/// VoidsVolumeFraction class inherits from AuxKernel
-class VoidsVolumeFraction : public AuxKernel
+/// VoidsVolumeFraction class inherits from ConstantAuxKernel
+class VoidsVolumeFraction : public ConstantAuxKernel
 {
 public:
   /// Required new syntax for InputParameters
@@ -51,6 +51,7 @@
 #pragma once
 
 #include "DGFluxLimitedBC.h"
+#include "StepwiseInput.h"
 
 /// DGFluxLimitedStepwiseBC class object inherits from DGFluxLimitedBC object
 /** This class object inherits from the DGFluxLimitedBC object.
@@ -80,7 +81,7 @@ protected:
   std::vector<Real> _input_times; ///< Values for determining when to change _u_input
   std::vector<Real> _time_spans;  ///< Amount of time it take to change to new input value
   std::vector<Real> _slopes;      ///< Slopes between each subsequent u_input
-  int index;                      ///< Index variable to keep track of location in vectors
+  Real _start_input;              ///< Value of u_input before the first input time
 
 private:
 };
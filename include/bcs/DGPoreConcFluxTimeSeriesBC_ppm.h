@@ -0,0 +1,56 @@
+/*!
+ *  \file DGPoreConcFluxTimeSeriesBC_ppm.h
+ *    \brief Boundary Condition kernel for the flux across a boundary with inlet ppm values from
+ * time-series data
+ *    \details This file creates a boundary condition kernel for the flux of matter across a
+ * boundary where the inlet value (in ppm) is read from a time-series data file through a
+ * TimeSeriesDataReader user object. Otherwise, the kernel is identical to DGPoreConcFluxBC_ppm.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "DGPoreConcFluxBC_ppm.h"
+#include "TimeSeriesDataReader.h"
+
+/// DGPoreConcFluxTimeSeriesBC_ppm class object inherits from DGPoreConcFluxBC_ppm object
+/** This class object inherits from the DGPoreConcFluxBC_ppm object and sets the
+    inlet value (in ppm) from a column of time-series data before each evaluation. */
+class DGPoreConcFluxTimeSeriesBC_ppm : public DGPoreConcFluxBC_ppm
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  DGPoreConcFluxTimeSeriesBC_ppm(const InputParameters & parameters);
+
+protected:
+  /// Required function override for BC objects in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required function override for BC objects in MOOSE
+  /** This function returns a Jacobian contribution for this object. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const TimeSeriesDataReader & _reader; ///< User object with the time-series data
+  const unsigned int _column;           ///< Index of the column for the inlet value (in ppm)
+  Real _scale;                          ///< Factor to convert the data to the inlet value in ppm
+
+private:
+};
@@ -55,6 +55,7 @@
 #pragma once
 
 #include "DGPoreDiffFluxLimitedBC.h"
+#include "StepwiseInput.h"
 
 /// DGPoreDiffFluxLimitedStepwiseBC class object inherits from DGPoreDiffFluxLimitedBC object
 /** This class object inherits from the DGPoreDiffFluxLimitedBC object.
@@ -92,7 +93,7 @@ protected:
   std::vector<Real> _input_times; ///< Values for determining when to change _u_input
   std::vector<Real> _time_spans;  ///< Amount of time it take to change to new input value
   std::vector<Real> _slopes;      ///< Slopes between each subsequent u_input
-  int index;                      ///< Index variable to keep track of location in vectors
+  Real _start_input;              ///< Value of u_input before the first input time
 
 private:
 };
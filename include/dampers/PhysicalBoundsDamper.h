@@ -0,0 +1,62 @@
+/*!
+ *  \file PhysicalBoundsDamper.h
+ *    \brief Nodal damper to keep concentrations, coverages and temperatures physical
+ *    \details This file creates a nodal damper that limits the Newton update of a variable so that
+ * the updated value remains physical. Concentrations are kept positive, surface coverages are kept
+ * between zero and the site density (which may be a coupled variable, as in
+ * VarSiteDensityExtLangModel), and temperatures are kept positive with a limit on the change over a
+ * single Newton step.
+ *
+ *            When an update would cross a bound, the step is scaled so that the variable moves only
+ *            a fraction (fraction_to_boundary) of the distance to that bound. Variables that are
+ *            already outside of a bound are not damped by that bound, so a solve is never stalled
+ *            by a slightly negative starting value.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This damper was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalDamper.h"
+#include "Coupleable.h"
+
+/// PhysicalBoundsDamper class object inherits from NodalDamper object
+/** This class object damps the Newton update of a variable so that the updated value
+    stays physical. Concentrations are kept positive, surface coverages are kept between
+    zero and the site density, and temperatures are kept positive with a limit on the
+    change in a single Newton step. */
+class PhysicalBoundsDamper : public NodalDamper, public Coupleable
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  PhysicalBoundsDamper(const InputParameters & parameters);
+
+protected:
+  /// Required function to compute the damping at the current node
+  virtual Real computeQpDamping() override;
+
+  /// Function to compute the damping that keeps the variable above the given lower bound
+  Real computeLowerBoundDamping(Real lower_bound);
+
+  /// Function to compute the damping that keeps the variable below the given upper bound
+  Real computeUpperBoundDamping(Real upper_bound);
+
+  const unsigned int _var_type;        ///< Variable type (0 = conc, 1 = coverage, 2 = temperature)
+  const VariableValue & _site_density; ///< Coupled site density for coverages (mol/L)
+  const Real _fraction;                ///< Fraction of the distance to a bound a step may take (-)
+  const Real _max_temp_change;         ///< Max change in temperature for a single step (K)
+
+private:
+};
@@ -0,0 +1,58 @@
+/*!
+ *  \file FVPoreConcFluxBC.h
+ *    \brief Finite volume boundary condition for the flux of a species across a boundary
+ *    \details This file creates a finite volume boundary condition for the advective flux of a
+ * species across a boundary of the domain. The flux is based on a velocity vector, as well as
+ * domain porosity, and is valid in all directions and all boundaries. This boundary condition will
+ * check the sign of the flux normal to the boundary and determine automatically whether it is an
+ * output or input boundary, then apply the appropriate conditions. This is the finite volume
+ * version of DGPoreConcFluxBC.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVFluxBC.h"
+
+/// FVPoreConcFluxBC class object inherits from FVFluxBC object
+/** This class object inherits from the FVFluxBC object in the MOOSE framework.
+    The flux BC uses the velocity in the system to apply a boundary condition based
+    on whether or not material is leaving or entering the boundary.
+
+    \note To create a specific inlet BC, inherit from this class and override the
+    inletValue() function. */
+class FVPoreConcFluxBC : public FVFluxBC
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  FVPoreConcFluxBC(const InputParameters & parameters);
+
+protected:
+  /// Function to give the inlet value of the variable at the current boundary face
+  virtual ADReal inletValue(const Moose::FaceArg & face, const Moose::StateArg & state);
+
+  /// Required residual function for FV BC objects in MOOSE
+  /** This function returns the flux of the variable through the current boundary face. */
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _ux;       ///< Velocity in the x-direction
+  const Moose::Functor<ADReal> & _uy;       ///< Velocity in the y-direction
+  const Moose::Functor<ADReal> & _uz;       ///< Velocity in the z-direction
+  const Moose::Functor<ADReal> & _porosity; ///< Porosity of the domain
+  Real _u_input;                            ///< Value of the variable at the inlet
+
+private:
+};
@@ -0,0 +1,54 @@
+/*!
+ *  \file FVPoreConcFluxBC_ppm.h
+ *    \brief Finite volume boundary condition for the flux of a species with a ppm input value
+ *    \details This file creates a finite volume boundary condition for the advective flux of a
+ * species across a boundary of the domain, where the input value is given in ppm. This is the
+ * finite volume version of DGPoreConcFluxBC_ppm.
+ *
+ *            Concentration will be converted from an inlet ppm value to molarity (either per L or
+ *            per m^3). Conversions will assume ideal gas conditions.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVPoreConcFluxBC.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// FVPoreConcFluxBC_ppm class object inherits from FVPoreConcFluxBC object
+/** This class object inherits from the FVPoreConcFluxBC object.
+    The inlet value is given in ppm and converted to a concentration using the
+    temperature and pressure at the boundary (assuming ideal gas conditions). */
+class FVPoreConcFluxBC_ppm : public FVPoreConcFluxBC
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  FVPoreConcFluxBC_ppm(const InputParameters & parameters);
+
+protected:
+  /// Function to convert the inlet ppm to a concentration at the current boundary face
+  virtual ADReal inletValue(const Moose::FaceArg & face, const Moose::StateArg & state) override;
+
+  const Moose::Functor<ADReal> & _temp;  ///< Temperature at the boundary (K)
+  const Moose::Functor<ADReal> & _press; ///< Pressure at the boundary (kPa)
+  Real _u_input_ppm;                     ///< Value of the variable at the inlet (ppm)
+  Real _R;                               ///< Gas law constant
+
+private:
+};
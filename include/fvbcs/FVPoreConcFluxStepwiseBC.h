@@ -0,0 +1,53 @@
+/*!
+ *  \file FVPoreConcFluxStepwiseBC.h
+ *    \brief Finite volume boundary condition for the flux of a species with stepwise input values
+ *    \details This file creates a finite volume boundary condition for the advective flux of a
+ * species across a boundary of the domain, where the input value changes at the given times.
+ * Changes can be sudden or ramped over a given time span. This is the finite volume version of
+ * DGPoreConcFluxStepwiseBC.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVPoreConcFluxBC.h"
+#include "StepwiseInput.h"
+
+/// FVPoreConcFluxStepwiseBC class object inherits from FVPoreConcFluxBC object
+/** This class object inherits from the FVPoreConcFluxBC object.
+    The inlet value changes (or ramps) to new values at the given input times in the
+    same way as in DGPoreConcFluxStepwiseBC. */
+class FVPoreConcFluxStepwiseBC : public FVPoreConcFluxBC
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for BC objects in MOOSE
+  FVPoreConcFluxStepwiseBC(const InputParameters & parameters);
+
+protected:
+  /// Function  to update the _u_input value based on given time
+  Real newInputValue(Real time);
+
+  /// Function to give the inlet value at the current time
+  virtual ADReal inletValue(const Moose::FaceArg & face, const Moose::StateArg & state) override;
+
+  std::vector<Real> _input_vals;  ///< Values for _u_input that update at corresponding times
+  std::vector<Real> _input_times; ///< Values for determining when to change _u_input
+  std::vector<Real> _time_spans;  ///< Amount of time it take to change to new input value
+  std::vector<Real> _slopes;      ///< Slopes between each subsequent u_input
+  Real _start_input;              ///< Value of u_input before the first input time
+
+private:
+};
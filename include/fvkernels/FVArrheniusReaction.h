@@ -0,0 +1,56 @@
+/*!
+ *  \file FVArrheniusReaction.h
+ *    \brief Finite volume kernel for a reaction with Arrhenius rate constants
+ *    \details This file creates a finite volume kernel for a reaction whose rate constants are
+ * computed from the temperature of each cell with modified Arrhenius expressions. This is the
+ * finite volume version of ArrheniusReaction. k = A * T^B * exp(-E / R / T)
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVConstReaction.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// FVArrheniusReaction class object inherits from FVConstReaction object
+/** This class object inherits from the FVConstReaction object in the MOOSE framework.
+    The rate constants are computed from the temperature of each cell with the same
+    modified Arrhenius expressions as ArrheniusReaction. */
+class FVArrheniusReaction : public FVConstReaction
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVArrheniusReaction(const InputParameters & parameters);
+
+protected:
+  /// Function to set the forward and reverse rates from the temperature of the cell
+  virtual void calculateRateConstants(const Moose::ElemArg & elem_arg,
+                                      const Moose::StateArg & state) override;
+
+  Real _pre_exp_for;    ///< Pre-exponential factor for forward reaction
+  Real _pre_exp_rev;    ///< Pre-exponential factor for reverse reaction
+  Real _act_energy_for; ///< Activation energy for forward reaction (J/mol)
+  Real _act_energy_rev; ///< Activation energy for reverse reaction (J/mol)
+  Real _beta_for;       ///< Temperature exponent for forward reaction
+  Real _beta_rev;       ///< Temperature exponent for reverse reaction
+
+  const Moose::Functor<ADReal> & _temp; ///< Temperature of the domain (K)
+
+private:
+};
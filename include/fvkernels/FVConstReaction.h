@@ -0,0 +1,59 @@
+/*!
+ *  \file FVConstReaction.h
+ *    \brief Finite volume kernel for a reaction with constant rate constants
+ *    \details This file creates a finite volume kernel for a reaction of the following form:
+ * sum(a_i * R_i) <-> sum(b_i * P_i), where the rate of the reaction is given as kf * prod(R_i^a_i)
+ * - kr * prod(P_i^b_i). The reactants and products are given as lists of coupled functors, in the
+ * same way as ConstReaction. Res = -scale * (kf * prod(R_i^a_i) - kr * prod(P_i^b_i))
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVElementalKernel.h"
+
+/// FVConstReaction class object inherits from FVElementalKernel object
+/** This class object inherits from the FVElementalKernel object in the MOOSE framework.
+    The kernel uses the same reactant/product lists as ConstReaction to create the
+    residual for a reaction in each cell of the domain.
+
+    \note To create a specific FV reaction kernel, inherit from this class and override
+    the calculateRateConstants() function. */
+class FVConstReaction : public FVElementalKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVConstReaction(const InputParameters & parameters);
+
+protected:
+  /// Function to set the forward and reverse rates for the current cell
+  virtual void calculateRateConstants(const Moose::ElemArg & elem_arg,
+                                      const Moose::StateArg & state);
+
+  /// Required residual function for FV kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  ADReal _forward_rate; ///< Forward rate constant
+  ADReal _reverse_rate; ///< Reverse rate constant
+  Real _scale;          ///< Scaling parameter for this reaction
+
+  std::vector<const Moose::Functor<ADReal> *> _reactants; ///< List of reactants
+  std::vector<Real> _react_stoich;                        ///< List of reactant stoichiometry
+  std::vector<const Moose::Functor<ADReal> *> _products;  ///< List of products
+  std::vector<Real> _prod_stoich;                         ///< List of product stoichiometry
+
+private:
+};
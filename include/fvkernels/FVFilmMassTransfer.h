@@ -0,0 +1,49 @@
+/*!
+ *  \file FVFilmMassTransfer.h
+ *    \brief Finite volume kernel for the film mass transfer between two variables
+ *    \details This file creates a finite volume kernel for the coupling of a pair of variables in
+ * the same domain as a form of mass/energy transfer with a variable rate. This is the finite volume
+ * version of FilmMassTransfer. Res = vf * Ga * km * (u - v) where u = this variable, v = coupled
+ * variable, Ga = area-to-volume ratio for the transfer (L^-1), km = transfer rate (L/T), and vf =
+ * volume fraction (-)
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVElementalKernel.h"
+
+/// FVFilmMassTransfer class object inherits from FVElementalKernel object
+/** This class object inherits from the FVElementalKernel object in the MOOSE framework.
+    The kernel interfaces a pair of variables to create a mass/energy transfer with a
+    variable transfer rate in each cell of the domain. */
+class FVFilmMassTransfer : public FVElementalKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVFilmMassTransfer(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for FV kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _coupled;        ///< Coupled variable
+  const Moose::Functor<ADReal> & _coupled_rate;   ///< Coupled rate variable (L/T)
+  const Moose::Functor<ADReal> & _area_to_volume; ///< Area to volume ratio (L^-1)
+  const Moose::Functor<ADReal> & _volfrac;        ///< Variable for volume fraction (-)
+
+private:
+};
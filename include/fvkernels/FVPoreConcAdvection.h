@@ -0,0 +1,50 @@
+/*!
+ *  \file FVPoreConcAdvection.h
+ *    \brief Finite volume kernel for the advection of a species in the pore space of a domain
+ *    \details This file creates a cell-centered finite volume kernel for the advective flux of a
+ * species through the internal faces of the domain. The velocity and porosity are coupled functors
+ * (variables, functions, or constants) that are evaluated at each face, and the concentration is
+ * fully upwinded. This kernel replaces the pair of GPoreConcAdvection and DGPoreConcAdvection
+ * kernels with a single unknown per cell. Flux = porosity * (v * n) * u_upwind
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVFluxKernel.h"
+
+/// FVPoreConcAdvection class object inherits from FVFluxKernel object
+/** This class object inherits from the FVFluxKernel object in the MOOSE framework.
+  The kernel computes the upwinded advective flux of the variable through each
+  internal face of the domain using a coupled velocity and porosity. */
+class FVPoreConcAdvection : public FVFluxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVPoreConcAdvection(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for FV flux kernels in MOOSE
+  /** This function returns the flux of the variable through the current face. */
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _ux;       ///< Velocity in the x-direction
+  const Moose::Functor<ADReal> & _uy;       ///< Velocity in the y-direction
+  const Moose::Functor<ADReal> & _uz;       ///< Velocity in the z-direction
+  const Moose::Functor<ADReal> & _porosity; ///< Porosity of the domain
+
+private:
+};
@@ -0,0 +1,50 @@
+/*!
+ *  \file FVVarPoreDiffusion.h
+ *    \brief Finite volume kernel for the diffusion of a species in the pore space of a domain
+ *    \details This file creates a cell-centered finite volume kernel for the diffusive flux of a
+ * species through the internal faces of the domain. The diffusion tensor is diagonal and each of
+ * its components is a coupled functor that is evaluated at each face along with the porosity. This
+ * kernel replaces the pair of GVarPoreDiffusion and DGVarPoreDiffusion kernels with a single
+ * unknown per cell. Flux = -porosity * (D * grad(u)) * n
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVFluxKernel.h"
+
+/// FVVarPoreDiffusion class object inherits from FVFluxKernel object
+/** This class object inherits from the FVFluxKernel object in the MOOSE framework.
+  The kernel computes the diffusive flux of the variable through each internal face
+  of the domain using a diagonal diffusion tensor whose components are coupled. */
+class FVVarPoreDiffusion : public FVFluxKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVVarPoreDiffusion(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for FV flux kernels in MOOSE
+  /** This function returns the flux of the variable through the current face. */
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _Dx;       ///< Diffusion in the x-direction
+  const Moose::Functor<ADReal> & _Dy;       ///< Diffusion in the y-direction
+  const Moose::Functor<ADReal> & _Dz;       ///< Diffusion in the z-direction
+  const Moose::Functor<ADReal> & _porosity; ///< Porosity of the domain
+
+private:
+};
@@ -0,0 +1,43 @@
+/*!
+ *  \file FVVariableCoefTimeDerivative.h
+ *    \brief Finite volume kernel for a time derivative with a variable coefficient
+ *    \details This file creates a finite volume kernel for a time derivative that is multiplied by
+ * another MOOSE variable or functor (e.g., a porosity that changes in space and time). This is the
+ * finite volume version of VariableCoefTimeDerivative. Res = coef * du/dt
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FVTimeKernel.h"
+
+/// FVVariableCoefTimeDerivative class object inherits from FVTimeKernel object
+/**
+ * Finite volume time derivative term multiplied by another variable as the coefficient.
+ *  This will be useful for domains that have a porosity that varies in space and time.
+ */
+class FVVariableCoefTimeDerivative : public FVTimeKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  FVVariableCoefTimeDerivative(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for FV kernels in MOOSE
+  virtual ADReal computeQpResidual() override;
+
+  const Moose::Functor<ADReal> & _coupled; ///< Coupled coefficient for the time derivative
+};
@@ -0,0 +1,65 @@
+/*!
+ *  \file ArrayFilmMassTransfer.h
+ *    \brief Array kernel for the film mass transfer of all species between two phases
+ *    \details This file creates an array kernel for the mass transfer of a set of species between
+ * two array variables (e.g., the bulk and pore space concentrations of all species). The kernel
+ * gives the same residual as FilmMassTransfer for each component. The transfer rate is a coupled
+ * array variable with one component per species, while the area-to-volume ratio and volume fraction
+ * are shared by all species. Res = test * vf * Ga * km * (u - v), where u = this array variable, v
+ * = the coupled array variable, Ga = area-to-volume ratio, km = transfer rate of each species, and
+ * vf = volume fraction
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrayKernel.h"
+
+/// ArrayFilmMassTransfer class object inherits from ArrayKernel object
+/** This class object inherits from the ArrayKernel object in the MOOSE framework.
+    All public and protected members of this class are required function overrides.
+    The kernel interfaces a pair of array variables to create a kernel for a mass
+    transfer of each species with a variable transfer rate per species. */
+class ArrayFilmMassTransfer : public ArrayKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayFilmMassTransfer(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for array kernels in MOOSE
+  /** This function computes the residual contribution of all species for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  /// Required Jacobian function for array kernels in MOOSE
+  /** This function returns the diagonal Jacobian contributions of all species for this object. */
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contributions for this object. */
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  const ArrayVariableValue & _coupled;      ///< Coupled array variable
+  const unsigned int _coupled_var;          ///< Variable identification for the coupled variable
+  const ArrayVariableValue & _coupled_rate; ///< Coupled rate array variable (L/T)
+  const unsigned int _coupled_rate_var;     ///< Variable identification for the rate variable
+  const VariableValue & _area_to_volume;    ///< Area to volume ratio (L^-1)
+  const unsigned int _area_to_volume_var; ///< Variable identification for couled area to vol ratio
+  const VariableValue & _volfrac;         ///< Variable for volume fraction (-)
+  const unsigned int _volfrac_var;        ///< Variable identification for volume fraction
+
+private:
+};
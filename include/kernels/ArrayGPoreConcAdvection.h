@@ -0,0 +1,66 @@
+/*!
+ *  \file ArrayGPoreConcAdvection.h
+ *    \brief Array kernel for advection of all species in the pore space of a domain
+ *    \details This file creates an array kernel for the advection of a set of species that are all
+ * stored in a single array variable (one component per species). The kernel gives the same residual
+ * as GPoreConcAdvection for each component, but all species at a quadrature point are contiguous in
+ * memory, so the whole set of species is evaluated with a single kernel call per element. All
+ * species share the same velocity and porosity. Res = -grad(test) * porosity * v * u
+ *
+ *            This kernel is meant to replace the per-species GPoreConcAdvection kernels in inputs
+ *            with many species in the continuous Galerkin formulation.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrayKernel.h"
+
+/// ArrayGPoreConcAdvection class object inherits from ArrayKernel object
+/** This class object inherits from the ArrayKernel object in the MOOSE framework.
+  All public and protected members of this class are required function overrides.
+  The kernel has a velocity vector whose components are coupled variables that are
+  shared by all species of the array variable. */
+class ArrayGPoreConcAdvection : public ArrayKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayGPoreConcAdvection(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for array kernels in MOOSE
+  /** This function computes the residual contribution of all species for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  /// Required Jacobian function for array kernels in MOOSE
+  /** This function returns the diagonal Jacobian contributions of all species for this object. */
+  virtual RealEigenVector computeQpJacobian() override;
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contributions for this object. */
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  RealVectorValue _velocity; ///< Velocity vector
+
+  const VariableValue & _ux;        ///< Velocity in the x-direction
+  const VariableValue & _uy;        ///< Velocity in the y-direction
+  const VariableValue & _uz;        ///< Velocity in the z-direction
+  const unsigned int _ux_var;       ///< Variable identification for ux
+  const unsigned int _uy_var;       ///< Variable identification for uy
+  const unsigned int _uz_var;       ///< Variable identification for uz
+  const VariableValue & _porosity;  ///< Porosity variable
+  const unsigned int _porosity_var; ///< Variable identification for porosity
+
+private:
+};
@@ -0,0 +1,65 @@
+/*!
+ *  \file ArrayGVarPoreDiffusion.h
+ *    \brief Array kernel for diffusion of all species in the pore space of a domain
+ *    \details This file creates an array kernel for the diffusion of a set of species that are all
+ * stored in a single array variable (one component per species). The kernel gives the same residual
+ * as GVarPoreDiffusion for each component, but all species at a quadrature point are contiguous in
+ * memory, so the whole set of species is evaluated with a single kernel call per element. The
+ * diffusion tensor is diagonal and each of the Dx, Dy, and Dz coefficients is a coupled array
+ * variable with one component per species. Res = test * porosity * (D * grad(u))
+ *
+ *            This kernel is meant to replace the per-species GVarPoreDiffusion kernels in inputs
+ *            with many species in the continuous Galerkin formulation.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrayKernel.h"
+
+/// ArrayGVarPoreDiffusion class object inherits from ArrayKernel object
+/** This class object inherits from the ArrayKernel object in the MOOSE framework.
+  All public and protected members of this class are required function overrides.
+  The kernel has a diagonal diffusion tensor for each species whose components are
+  given by coupled array variables. */
+class ArrayGVarPoreDiffusion : public ArrayKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayGVarPoreDiffusion(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for array kernels in MOOSE
+  /** This function computes the residual contribution of all species for this object.*/
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  /// Required Jacobian function for array kernels in MOOSE
+  /** This function returns the diagonal Jacobian contributions of all species for this object. */
+  virtual RealEigenVector computeQpJacobian() override;
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contributions for this object. */
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  const ArrayVariableValue & _Dx;   ///< Array variable for diffusion in x-direction
+  const unsigned int _Dx_var;       ///< Variable identification for Dx
+  const ArrayVariableValue & _Dy;   ///< Array variable for diffusion in y-direction
+  const unsigned int _Dy_var;       ///< Variable identification for Dy
+  const ArrayVariableValue & _Dz;   ///< Array variable for diffusion in z-direction
+  const unsigned int _Dz_var;       ///< Variable identification for Dz
+  const VariableValue & _porosity;  ///< Porosity variable
+  const unsigned int _porosity_var; ///< Variable identification for porosity
+
+private:
+};
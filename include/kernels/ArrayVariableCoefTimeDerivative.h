@@ -0,0 +1,52 @@
+/*!
+ *  \file ArrayVariableCoefTimeDerivative.h
+ *    \brief Array kernel for a time derivative of all species with a variable coefficient
+ *    \details This file creates an array kernel for the time derivative of a set of species that
+ * are all stored in a single array variable (one component per species). The kernel gives the same
+ * residual as VariableCoefTimeDerivative for each component, where all species share the same
+ * coupled coefficient (e.g., the porosity of the domain). Res = test * coef * du/dt
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrayTimeKernel.h"
+
+/// ArrayVariableCoefTimeDerivative class object inherits from ArrayTimeKernel object
+/**
+ * Time derivative term of all species of an array variable multiplied by another
+ *  variable as the coefficient. This will be useful for domains that have a porosity
+ *  that varies in space and time.
+ */
+class ArrayVariableCoefTimeDerivative : public ArrayTimeKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrayVariableCoefTimeDerivative(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for array kernels in MOOSE
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+
+  /// Required Jacobian function for array kernels in MOOSE
+  virtual RealEigenVector computeQpJacobian() override;
+
+  /// Off diagonal Jacobian for the coupled coefficient
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  const VariableValue & _coupled;  ///< Coupled coefficient variable
+  const unsigned int _coupled_var; ///< Variable identification for the coupled coefficient
+};
@@ -40,6 +40,9 @@ public:
   ArrheniusEquilibriumReaction(const InputParameters & parameters);
 
 protected:
+  /// Function to update the reverse parameters from the (zoned or controlled) forward parameters
+  virtual void subdomainSetup() override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
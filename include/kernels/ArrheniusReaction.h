@@ -39,7 +39,14 @@ public:
   /// Required constructor for objects in MOOSE
   ArrheniusReaction(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** The residual is only linear if the temperature is not one of the unknowns. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
+  /// Function to set the zoned Arrhenius parameters when the kernel enters a new subdomain
+  virtual void subdomainSetup() override;
+
   ///  Function to compute the rate constants
   void calculateRateConstants();
 
@@ -59,6 +66,9 @@ protected:
    cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// Function to compute the derivative of the residual (per test) with respect to temperature
+  Real computeQpTemperatureDerivative();
+
   Real _act_energy_for;         ///< Activation energy forward (J/mol)
   Real _act_energy_rev;         ///< Activation energy reverse (J/mol)
   Real _pre_exp_for;            ///< Pre-exponential factor forward (same units as kf)
@@ -68,5 +78,10 @@ protected:
   const VariableValue & _temp;  ///< Coupled temperature variable (K)
   const unsigned int _temp_var; ///< Variable identification for temperature
 
+  std::vector<Real> _zone_act_energy_for; ///< Activation energies forward for each zone (J/mol)
+  std::vector<Real> _zone_act_energy_rev; ///< Activation energies reverse for each zone (J/mol)
+  std::vector<Real> _zone_pre_exp_for;    ///< Pre-exponential factors forward for each zone
+  std::vector<Real> _zone_pre_exp_rev;    ///< Pre-exponential factors reverse for each zone
+
 private:
 };
@@ -42,6 +42,9 @@ public:
   /// Required constructor for objects in MOOSE
   ArrheniusReactionEnergyTransfer(const InputParameters & parameters);
 
+  /// Function override to return false, since the energy source is not checked for linearity
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
@@ -0,0 +1,59 @@
+/*!
+ *  \file ConcentrationTransform.h
+ *    \brief Helper class for species solved in log or asinh transformed variables
+ *    \details This file creates a helper class that is inherited by kernels for species that are
+ * solved in a transformed variable w instead of the concentration C. Trace species span many orders
+ * of magnitude, and solving for w = ln(C) (or w = asinh(C/C_ref)) improves the conditioning of the
+ * system and keeps the concentration positive (log transformation).
+ *
+ *            The log transformation is C = exp(w) and the asinh transformation is C =
+ *            C_ref*sinh(w). The asinh transformation behaves like a log transformation for C >>
+ *            C_ref, and is linear near zero, so it may be used for species whose concentration can
+ *            reach zero.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+
+/// ConcentrationTransform class object for species solved in transformed variables
+/** This class object is not a MOOSE object by itself. It is inherited (along with a standard
+    kernel) by each of the transformed kernels to give a common set of parameters and the
+    map from the transformed variable (w) to the concentration (C). Each transformed kernel
+    must call addTransformParams in its validParams.
+
+    log:   C = exp(w)
+    asinh: C = transform_scale * sinh(w) */
+class ConcentrationTransform
+{
+public:
+  /// Function to add the transformation parameters to a derived kernel
+  static void addTransformParams(InputParameters & params);
+
+  /// Constructor for the transformation parameters
+  ConcentrationTransform(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the concentration from the transformed variable
+  Real concentration(Real w) const;
+
+  /// Function to compute the derivative of the concentration with respect to w
+  Real concentrationDerivative(Real w) const;
+
+  /// Function to compute the second derivative of the concentration with respect to w
+  Real concentrationSecondDerivative(Real w) const;
+
+  const unsigned int _transform; ///< Type of transformation (0 = log, 1 = asinh)
+  const Real _transform_scale;   ///< Reference concentration for the asinh transformation
+};
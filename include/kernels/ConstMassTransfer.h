@@ -24,13 +24,14 @@
 #pragma once
 
 #include "Kernel.h"
+#include "ZonedParameters.h"
 
 /// ConstMassTransfer class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
     All public and protected members of this class are required function overrides.
     The kernel interfaces the pair of non-linear variables to create a kernel for a
     mass/energy transfer. */
-class ConstMassTransfer : public Kernel
+class ConstMassTransfer : public Kernel, public ZonedParameters
 {
 public:
   /// Required new syntax for InputParameters
@@ -40,6 +41,9 @@ public:
   ConstMassTransfer(const InputParameters & parameters);
 
 protected:
+  /// Function to set the zoned transfer rate when the kernel enters a new subdomain
+  virtual void subdomainSetup() override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
@@ -56,9 +60,10 @@ protected:
    cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
-  Real _trans_rate;                ///< Rate constant for mass/energy transfer
-  const VariableValue & _coupled;  ///< Coupled variable
-  const unsigned int _coupled_var; ///< Variable identification for the coupled variable
+  Real _trans_rate;                   ///< Rate constant for mass/energy transfer
+  const VariableValue & _coupled;     ///< Coupled variable
+  const unsigned int _coupled_var;    ///< Variable identification for the coupled variable
+  std::vector<Real> _zone_trans_rate; ///< Rate constants for mass/energy transfer for each zone
 
 private:
 };
@@ -26,13 +26,15 @@
 #pragma once
 
 #include "Kernel.h"
+#include "LinearityInterface.h"
+#include "ZonedParameters.h"
 
 /// ConstReaction class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
     All public and protected members of this class are required function overrides.
     The kernel interfaces the set of non-linear variables to create a kernel for a
     reaction or chemical mechanism. */
-class ConstReaction : public Kernel
+class ConstReaction : public Kernel, public LinearityInterface, public ZonedParameters
 {
 public:
   /// Required new syntax for InputParameters
@@ -41,7 +43,13 @@ public:
   /// Required constructor for objects in MOOSE
   ConstReaction(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
+  /// Function to set the zoned rate constants when the kernel enters a new subdomain
+  virtual void subdomainSetup() override;
+
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
   virtual Real computeQpResidual();
@@ -58,6 +66,23 @@ protected:
    cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// Function to compute the product of the reactants raised to their stoichiometry
+  Real computeReactantProduct();
+
+  /// Function to compute the product of the products raised to their stoichiometry
+  Real computeProductProduct();
+
+  /// Function to compute the derivative of the reactant product with respect to the i-th reactant
+  Real computeReactantProductDerivative(unsigned int i);
+
+  /// Function to compute the derivative of the product product with respect to the i-th product
+  Real computeProductProductDerivative(unsigned int i);
+
+  /// Function to check if the forward and reverse terms are linear in the given system
+  /** The forward_on and reverse_on arguments tell whether or not the terms are active
+      (i.e., have a non-zero rate constant). Inactive terms are always linear. */
+  bool linearReactionTerms(const SystemBase & sys, bool forward_on, bool reverse_on) const;
+
   Real _forward_rate;                            ///< Rate constant for forward reaction
   Real _reverse_rate;                            ///< Rate constant for reverse reaction
   Real _scale;                                   ///< Scaling parameter for the reaction
@@ -74,5 +99,8 @@ protected:
   int indexReact;               ///< Local index for the main variable in the reactant list
   int indexProd;                ///< Local index for the main variable in the reactant list
 
+  std::vector<Real> _zone_forward_rate; ///< Forward rate constants for each zone
+  std::vector<Real> _zone_reverse_rate; ///< Reverse rate constants for each zone
+
 private:
 };
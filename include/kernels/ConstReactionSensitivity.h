@@ -0,0 +1,67 @@
+/*!
+ *  \file ConstReactionSensitivity.h
+ *  \brief Kernel for the forward parametric sensitivity of a ConstReaction
+ *  \details This file creates a standard MOOSE kernel for the forward sensitivity equations of a
+ * generic reaction with constant rate coefficients. The kernel acts on the sensitivity variable
+ * (s = dC/dp) of 'this_variable' and is the derivative of the ConstReaction residual with respect
+ * to a single parameter p. Since all the transport and time derivative kernels in CATS are linear
+ * in the concentrations, the same kernels applied to the sensitivity variables complete the forward
+ * sensitivity system, which is then solved simultaneously with the original system. The residual
+ * for this kernel is as follows Res = sum(i, dR/dC_i * s_i) + dR/dp where R is the ConstReaction
+ * residual and s_i are the sensitivity variables for each reactant and product. The parameter p
+ * is either the forward or reverse rate, or 'none' if the reaction does not depend on p (in which
+ * case only the tangent term is needed).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ReactionSensitivity.h"
+
+/// ConstReactionSensitivity class object inherits from ReactionSensitivity
+/** This class object inherits from the ReactionSensitivity template in the CATS framework.
+    All public and protected members of this class are required function overrides.
+    The kernel forms the forward sensitivity of the reaction with respect to a parameter. */
+class ConstReactionSensitivity : public ReactionSensitivity<ConstReaction>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ConstReactionSensitivity(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the derivative of the residual (per test function) with respect to p
+  Real computeQpParameterDerivative();
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual();
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian();
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  const unsigned int _sens_param; ///< Parameter the sensitivity is taken with respect to
+
+private:
+};
@@ -23,13 +23,14 @@
 #pragma once
 
 #include "Kernel.h"
+#include "LinearityInterface.h"
 
 /// CoupledCoeffTimeDerivative class object inherits from Kernel object
 /** This class object inherits from the Kernel object in the MOOSE framework.
   All public and protected members of this class are required function overrides.
   The kernel interfaces the two non-linear variables to couple a time derivative
   function between given objects. */
-class CoupledCoeffTimeDerivative : public Kernel
+class CoupledCoeffTimeDerivative : public Kernel, public LinearityInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -38,6 +39,10 @@ public:
   /// Required constructor for objects in MOOSE
   CoupledCoeffTimeDerivative(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** The residual is always linear in the coupled variable. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
@@ -54,11 +59,22 @@ protected:
     cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
-  bool _gaining;                       ///< Value is true if the time coef is positive
-  Real _time_coef;                     ///< Time coefficient for the coupled time derivative
-  const VariableValue & _coupled_dot;  ///< Time derivative of the coupled variable
-  const VariableValue & _coupled_ddot; ///< Cross derivative term for the coupled variables
-  const unsigned int _coupled_var;     ///< Variable identification for the coupled variable
+  /// Function to give the time derivative of the coupled variable for the current test function
+  /** Returns the value at the current qp, or the nodal value of the current test function
+      if the mass is lumped. */
+  Real timeDerivativeValue();
+
+  /// Function to give the trial function of the time derivative for the Jacobian
+  /** Returns the value at the current qp, or the Kronecker delta if the mass is lumped. */
+  Real massTrialFunction();
+
+  bool _gaining;                            ///< Value is true if the time coef is positive
+  Real _time_coef;                          ///< Time coefficient for the coupled time derivative
+  const VariableValue & _coupled_dot;       ///< Time derivative of the coupled variable
+  const VariableValue & _coupled_ddot;      ///< Cross derivative term for the coupled variables
+  const unsigned int _coupled_var;          ///< Variable identification for the coupled variable
+  const bool _lumped;                       ///< True if the mass is lumped to the nodes
+  const VariableValue * _coupled_dot_nodal; ///< Time derivative of the coupled variable at nodes
 
 private:
 };
@@ -37,6 +37,9 @@ public:
   /// Required constructor for objects in MOOSE
   CoupledPorePhaseTransfer(const InputParameters & parameters);
 
+  /// Function override to return false, since the phase coefficients are not checked
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
@@ -48,6 +48,9 @@ public:
   /// Required constructor for objects in MOOSE
   EquilibriumReaction(const InputParameters & parameters);
 
+  /// Function override to return false, since the equilibrium constant depends on temperature
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   ///  Function to compute the equilibrium constant
   void calculateEquilibriumConstant();
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "GConcentrationAdvection.h"
+#include "LinearityInterface.h"
 
 /// GConcentrationAdvection class object inherits from GConcentrationAdvection object
 /** This class object inherits from the GConcentrationAdvection object in the MOOSE framework.
@@ -31,7 +32,7 @@
   \note To create a specific GConcentrationAdvection kernel, inherit from this class and override
   the components of the velocity vector, then call the residual and Jacobian functions
   for this object. */
-class GPoreConcAdvection : public GConcentrationAdvection
+class GPoreConcAdvection : public GConcentrationAdvection, public LinearityInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -40,6 +41,10 @@ public:
   /// Required constructor for objects in MOOSE
   GPoreConcAdvection(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** The residual is only linear if the velocity and porosity are not unknowns. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "GVariableDiffusion.h"
+#include "LinearityInterface.h"
 
 /// GVarPoreDiffusion class object inherits from GVariableDiffusion object
 /** This class object inherits from the GVariableDiffusion object in the MOOSE framework.
@@ -34,7 +35,7 @@
   \note To create a specific GVarPoreDiffusion kernel, inherit from this class and override
   the components of the diffusion tensor, then call the residual and Jacobian functions
   for this object. */
-class GVarPoreDiffusion : public GVariableDiffusion
+class GVarPoreDiffusion : public GVariableDiffusion, public LinearityInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -43,6 +44,10 @@ public:
   /// Required constructor for objects in MOOSE
   GVarPoreDiffusion(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** The residual is only linear if the diffusivity and porosity are not unknowns. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
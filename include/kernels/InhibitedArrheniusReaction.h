@@ -47,6 +47,9 @@ public:
   /// Required constructor for objects in MOOSE
   InhibitedArrheniusReaction(const InputParameters & parameters);
 
+  /// Function override to return false, since the inhibition term is not checked for linearity
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   ///  Function to compute the rate constants
   void calculateInhibitedRateConstants();
@@ -0,0 +1,95 @@
+/*!
+ *  \file InhibitedArrheniusReactionSensitivity.h
+ *  \brief Kernel for the forward parametric sensitivity of an InhibitedArrheniusReaction
+ *  \details This file creates a standard MOOSE kernel for the forward sensitivity equations of an
+ * inhibited Arrhenius reaction coupled with temperature. The kernel acts on the sensitivity
+ * variable (s = dC/dp) of 'this_variable' and is the derivative of the InhibitedArrheniusReaction
+ * residual with respect to a single parameter p (i.e., a pre-exponential factor, activation energy,
+ * or beta term). The residual for this kernel is as follows
+ * Res = sum(i, dR/dC_i * s_i) + dR/dT * s_T + dR/dRf * s_Rf + dR/dRr * s_Rr + dR/dp where R is the
+ * InhibitedArrheniusReaction residual, s_i are the sensitivity variables for each reactant and
+ * product, and s_T, s_Rf, and s_Rr are the (optional) sensitivities of temperature and the forward
+ * and reverse inhibition terms. Use 'none' for the parameter if the reaction does not depend on
+ * p (in which case only the tangent terms are needed).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ReactionSensitivity.h"
+#include "InhibitedArrheniusReaction.h"
+
+/// InhibitedArrheniusReactionSensitivity class object inherits from ReactionSensitivity
+/** This class object inherits from the ReactionSensitivity template in the CATS framework.
+    All public and protected members of this class are required function overrides.
+    The kernel forms the forward sensitivity of the reaction with respect to a parameter. */
+class InhibitedArrheniusReactionSensitivity : public ReactionSensitivity<InhibitedArrheniusReaction>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  InhibitedArrheniusReactionSensitivity(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the derivative of the residual (per test function) with respect to p
+  Real computeQpParameterDerivative();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to Rf
+  Real computeQpForwardInhibitionDerivative();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to Rr
+  Real computeQpReverseInhibitionDerivative();
+
+  /// Function to compute the derivative of the forward rate constant along the sensitivity
+  Real computeQpForwardRateTangent();
+
+  /// Function to compute the derivative of the reverse rate constant along the sensitivity
+  Real computeQpReverseRateTangent();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to T
+  Real computeQpTemperatureJacobian();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to Rf
+  Real computeQpForwardInhibitionJacobian();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to Rr
+  Real computeQpReverseInhibitionJacobian();
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual();
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian();
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  const unsigned int _sens_param;    ///< Parameter the sensitivity is taken with respect to
+  const VariableValue & _temp_sens;  ///< Coupled temperature sensitivity variable
+  const unsigned int _temp_sens_var; ///< Variable identification for the temperature sensitivity
+  const VariableValue & _Rf_sens;    ///< Coupled forward inhibition sensitivity variable
+  const unsigned int _Rf_sens_var;   ///< Variable identification for the Rf sensitivity
+  const VariableValue & _Rr_sens;    ///< Coupled reverse inhibition sensitivity variable
+  const unsigned int _Rr_sens_var;   ///< Variable identification for the Rr sensitivity
+
+private:
+};
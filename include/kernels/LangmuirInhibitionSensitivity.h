@@ -0,0 +1,86 @@
+/*!
+ *  \file LangmuirInhibitionSensitivity.h
+ *    \brief Kernel for the forward parametric sensitivity of a LangmuirInhibition
+ *    \details This file creates a standard MOOSE kernel for the forward sensitivity equations of a
+ * Langmuir inhibition function. The kernel acts on the sensitivity variable (s_R = dR/dp) of the
+ * inhibition variable and is the derivative of the LangmuirInhibition residual with respect to a
+ * single parameter p (i.e., the pre-exponential, activation energy, or beta term of one of the
+ * Langmuir coefficients)... i.e., Res = -[sum(i, K_i*s_i) + sum(i, dK_i/dT*C_i)*s_T + dK_k/dp*C_k]
+ * where s_i are the sensitivity variables of the coupled concentrations and s_T is the
+ * (optional) sensitivity of temperature. Use 'none' for the parameter if the inhibition term does
+ * not depend on p (in which case only the tangent terms are needed).
+ *
+ *  \note This should be used in conjunction with a Reaction kernel acting on the sensitivity
+ *        variable, in the same way that LangmuirInhibition is paired with a Reaction kernel.
+ *
+ *  \author Austin Ladshaw
+ *    \date 10/18/2026
+ *    \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "LangmuirInhibition.h"
+
+/// LangmuirInhibitionSensitivity class object inherits from LangmuirInhibition object
+class LangmuirInhibitionSensitivity : public LangmuirInhibition
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  LangmuirInhibitionSensitivity(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the derivative of the Langmuir sum with respect to temperature
+  Real computeLangmuirTempDerivative();
+
+  /// Function to compute the derivative of the Langmuir sum with respect to the parameter p
+  Real computeLangmuirParameterDerivative();
+
+  /// Function to compute the derivative of the Langmuir coefficient with respect to p
+  Real computeLangmuirParameterCoefficient();
+
+  /// Function to compute the temperature derivative of computeLangmuirParameterCoefficient
+  Real computeLangmuirParameterTemperatureCoefficient();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to T
+  Real computeQpTemperatureJacobian();
+
+  /// Function to compute the derivative of the residual (per test function) with respect to C
+  Real computeQpConcentrationJacobian(unsigned int jvar);
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual();
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian();
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar);
+
+  std::vector<const VariableValue *>
+      _coupled_sens; ///< Pointer list to the sensitivities of the coupled gases
+  std::vector<unsigned int> _coupled_sens_vars; ///< Indices for the coupled sensitivities
+  const VariableValue & _temp_sens;             ///< Coupled temperature sensitivity variable
+  const unsigned int _temp_sens_var; ///< Variable identification for the temperature sensitivity
+  const unsigned int _sens_param;    ///< Parameter the sensitivity is taken with respect to
+  const unsigned int _sens_index;    ///< Index of the Langmuir coefficient the parameter belongs to
+
+private:
+};
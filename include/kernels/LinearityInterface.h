@@ -0,0 +1,60 @@
+/*!
+ *  \file LinearityInterface.h
+ *    \brief Helper class for objects that declare linearity in their unknowns
+ *    \details This file creates a helper class that is inherited by kernels that can declare their
+ * residual to be linear in the unknowns (i.e., the non-linear variables of the system). A residual
+ * is linear if all coefficients (e.g., porosity, velocity, diffusivity, and temperature in an
+ * Arrhenius rate) are auxiliary variables or constants, and the unknowns only appear to the first
+ * power.
+ *
+ *            The LinearSystemDetector user object uses this interface to find out if the whole
+ *            system of equations is linear, so the system can be solved with one linear solve per
+ *            time step.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "InputParameters.h"
+#include "SystemBase.h"
+
+/// LinearityInterface class object for objects that can declare their residual to be linear
+/** This class object is not a MOOSE object by itself. It is inherited (along with a standard
+    kernel) by objects whose residual is linear in the unknowns for some choices of their
+    parameters (e.g., first order reactions with constant rates). The LinearSystemDetector
+    uses this interface to find out if the whole system of equations is linear. */
+class LinearityInterface
+{
+public:
+  /// Virtual destructor for the interface
+  virtual ~LinearityInterface() {}
+
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** Derived objects that change the residual must override this function (e.g., to return
+      false), so that added nonlinearities are not taken to be linear. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const = 0;
+
+protected:
+  /// Function to check if any of the variables of a coupled parameter are in the given system
+  static bool hasUnknowns(const InputParameters & params,
+                          const std::string & coupled_param,
+                          const SystemBase & sys);
+
+  /// Function to check if a product of coupled variables raised to their stoichiometry is linear
+  /** The product is linear if there are no unknowns in the list, or if there is only one
+      unknown in the list and its stoichiometry is 1. */
+  static bool isLinearProduct(const InputParameters & params,
+                              const std::string & coupled_param,
+                              const std::vector<Real> & stoich,
+                              const SystemBase & sys);
+};
@@ -46,6 +46,15 @@ protected:
       system and is used in preconditioning of the linear sub-problem. */
   virtual Real computeQpJacobian();
 
+  /// Function to give the time derivative of the variable for the current test function
+  /** Returns the value at the current qp, or the nodal value of the current test function
+      if the mass is lumped. */
+  Real timeDerivativeValue();
+
+  /// Function to give the trial function of the time derivative for the Jacobian
+  /** Returns the value at the current qp, or the Kronecker delta if the mass is lumped. */
+  Real massTrialFunction();
+
   Real
       _nodal_time_coef; ///< Time coefficient for the coupled time derivative at given node in microscale
   Real _total_length; ///< Total length of the microscale [Global]
@@ -56,6 +65,8 @@ protected:
   unsigned int _total_nodes; ///< Total number of nodes to discretize the microscale with [Global]
   unsigned int
       _coord_id; ///< Coordinate id number ( 0 = cartesian, 1 = r-cylindrical, 2 = r-spherical ) [Global]
+  const bool _lumped;                 ///< True if the mass is lumped to the nodes
+  const VariableValue & _u_dot_nodal; ///< Time derivative of the variable at the nodes
 
 private:
 };
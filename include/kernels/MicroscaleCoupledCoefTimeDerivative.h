@@ -51,6 +51,15 @@ protected:
       cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// Function to give the time derivative of the coupled variable for the current test function
+  /** Returns the value at the current qp, or the nodal value of the current test function
+      if the mass is lumped. */
+  Real timeDerivativeValue();
+
+  /// Function to give the trial function of the time derivative for the Jacobian
+  /** Returns the value at the current qp, or the Kronecker delta if the mass is lumped. */
+  Real massTrialFunction();
+
   Real
       _nodal_time_coef; ///< Time coefficient for the coupled time derivative at given node in microscale
   Real _total_length; ///< Total length of the microscale [Global]
@@ -62,9 +71,11 @@ protected:
   unsigned int
       _coord_id; ///< Coordinate id number ( 0 = cartesian, 1 = r-cylindrical, 2 = r-spherical ) [Global]
 
-  const VariableValue & _coupled_dot;  ///< Time derivative of the coupled variable
-  const VariableValue & _coupled_ddot; ///< Cross derivative term for the coupled variables
-  const unsigned int _coupled_var;     ///< Variable identification for the coupled variable
+  const VariableValue & _coupled_dot;       ///< Time derivative of the coupled variable
+  const VariableValue & _coupled_ddot;      ///< Cross derivative term for the coupled variables
+  const unsigned int _coupled_var;          ///< Variable identification for the coupled variable
+  const bool _lumped;                       ///< True if the mass is lumped to the nodes
+  const VariableValue * _coupled_dot_nodal; ///< Time derivative of the coupled variable at nodes
 
 private:
 };
@@ -0,0 +1,74 @@
+/*!
+ *  \file QuasiEquilibriumTimeDerivative.h
+ *    \brief Kernel for the accumulation of an adsorbed species in local equilibrium
+ *    \details This file creates a kernel for the accumulation of an adsorbed species that is in
+ * local equilibrium with the species in a balance. The residual is Res = a * (q - q_old) / dt where
+ * a = scaling variable (e.g., the solids fraction) and q = adsorbed species material property
+ * (e.g., from the QuasiEquilibriumAdsorption material).
+ *
+ *            The Jacobian uses the derivatives of the adsorbed species with respect to the variable
+ *            of this kernel and the variables in the coupled_variables list.
+ *
+ *            The residual is the backward (implicit) Euler difference of the adsorbed species, so
+ *            this kernel is only valid with the implicit-euler time integration scheme. Other
+ *            schemes (e.g., bdf2 or crank-nicolson) will give wrong accumulation for this term.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
+
+/// QuasiEquilibriumTimeDerivative class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+    All public and protected members of this class are required function overrides.
+    The kernel adds the accumulation of an adsorbed species that is in local equilibrium
+    (e.g., from the QuasiEquilibriumAdsorption material) to a species balance, with
+    variable scaling. Only valid with the implicit-euler time integration scheme. */
+class QuasiEquilibriumTimeDerivative : public DerivativeMaterialInterface<Kernel>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  QuasiEquilibriumTimeDerivative(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const MaterialProperty<Real> & _q;                    ///< Adsorbed species property
+  const MaterialProperty<Real> & _q_old;                ///< Adsorbed species at the last time step
+  const MaterialProperty<Real> & _dq_du;                ///< Derivative for this variable
+  std::vector<unsigned int> _arg_vars;                  ///< Indices for the coupled variables
+  std::vector<const MaterialProperty<Real> *> _dq_darg; ///< Derivatives for the coupled variables
+  const VariableValue & _scale;                         ///< Scaling variable
+  const unsigned int _scale_var;                        ///< Variable identification for scaling
+
+private:
+};
@@ -0,0 +1,201 @@
+/*!
+ *  \file RateLawPolicies.h
+ *    \brief Policy classes for composing reaction kernels at compile time
+ *    \details This file creates policy classes for the RateLawReaction kernel template. A rate
+ * constant policy gives the forward and reverse rate constants (and their temperature derivatives)
+ * at a quadrature point, a concentration policy gives the concentration terms of the rate and their
+ * derivatives, and an inhibition policy tells the kernel whether the rate constants are divided by
+ * coupled inhibition terms.
+ *
+ *            The policies are plain classes whose compute functions are inlined into the kernel
+ *            template, so the composed kernel has no virtual calls or redundant recomputation
+ *            between the layers of the rate expression.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// ConstantRateConstants policy for the RateLawReaction kernel template
+/** Gives constant forward and reverse rate constants (same as ConstReaction). */
+class ConstantRateConstants
+{
+public:
+  /// True if the rate constants depend on a coupled temperature
+  static const bool temperature_dependent = false;
+
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & params);
+
+  /// Constructor reads the parameters of the policy
+  ConstantRateConstants(const InputParameters & parameters);
+
+  /// Function to compute the rate constants and their derivatives with respect to temperature
+  inline void compute(Real /*T*/, Real & kf, Real & kr, Real & dkf_dT, Real & dkr_dT) const
+  {
+    kf = _forward_rate;
+    kr = _reverse_rate;
+    dkf_dT = 0.0;
+    dkr_dT = 0.0;
+  }
+
+protected:
+  const Real _forward_rate; ///< Rate constant for forward reaction
+  const Real _reverse_rate; ///< Rate constant for reverse reaction
+};
+
+/// ArrheniusRateConstants policy for the RateLawReaction kernel template
+/** Gives the rate constants as k = A * T^B * exp(-E/R/T) (same as ArrheniusReaction). */
+class ArrheniusRateConstants
+{
+public:
+  /// True if the rate constants depend on a coupled temperature
+  static const bool temperature_dependent = true;
+
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & params);
+
+  /// Constructor reads the parameters of the policy
+  ArrheniusRateConstants(const InputParameters & parameters);
+
+  /// Function to compute the rate constants and their derivatives with respect to temperature
+  inline void compute(Real T, Real & kf, Real & kr, Real & dkf_dT, Real & dkr_dT) const
+  {
+    kf = _pre_exp_for * std::pow(T, _beta_for) * std::exp(-_act_energy_for / Rstd / T);
+    kr = _pre_exp_rev * std::pow(T, _beta_rev) * std::exp(-_act_energy_rev / Rstd / T);
+    dkf_dT = kf * (_act_energy_for / Rstd / T / T + _beta_for / T);
+    dkr_dT = kr * (_act_energy_rev / Rstd / T / T + _beta_rev / T);
+  }
+
+protected:
+  Real _act_energy_for; ///< Activation energy forward (J/mol)
+  Real _act_energy_rev; ///< Activation energy reverse (J/mol)
+  Real _pre_exp_for;    ///< Pre-exponential factor forward (same units as kf)
+  Real _pre_exp_rev;    ///< Pre-exponential factor reverse (same units as kr)
+  Real _beta_for;       ///< Temperature exponential forward (-)
+  Real _beta_rev;       ///< Temperature exponential reverse (-)
+};
+
+/// ArrheniusEquilibriumRateConstants policy for the RateLawReaction kernel template
+/** Gives the forward rate constant from the Arrhenius expression and the reverse rate constant
+    from the reaction enthalpy and entropy (same as ArrheniusEquilibriumReaction). */
+class ArrheniusEquilibriumRateConstants : public ArrheniusRateConstants
+{
+public:
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & params);
+
+  /// Constructor reads the parameters of the policy
+  ArrheniusEquilibriumRateConstants(const InputParameters & parameters);
+};
+
+/// EquilibriumRateConstants policy for the RateLawReaction kernel template
+/** Gives the forward rate constant as the equilibrium constant K = exp(-dH/R/T + dS/R) with a
+    reverse rate constant of 1 (same as EquilibriumReaction). */
+class EquilibriumRateConstants
+{
+public:
+  /// True if the rate constants depend on a coupled temperature
+  static const bool temperature_dependent = true;
+
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & params);
+
+  /// Constructor reads the parameters of the policy
+  EquilibriumRateConstants(const InputParameters & parameters);
+
+  /// Function to compute the rate constants and their derivatives with respect to temperature
+  inline void compute(Real T, Real & kf, Real & kr, Real & dkf_dT, Real & dkr_dT) const
+  {
+    kf = std::exp(-(_enthalpy / (Rstd * T)) + (_entropy / Rstd));
+    kr = 1.0;
+    dkf_dT = kf * _enthalpy / Rstd / T / T;
+    dkr_dT = 0.0;
+  }
+
+protected:
+  const Real _enthalpy; ///< Reaction enthalpy (J/mol)
+  const Real _entropy;  ///< Reaction entropy (J/K/mol)
+};
+
+/// PowerLawConcentrations policy for the RateLawReaction kernel template
+/** Gives the concentration terms of the rate as the product of the species raised to their
+    stoichiometry (same as ConstReaction). */
+class PowerLawConcentrations
+{
+public:
+  /// Function to compute the product of the species raised to their stoichiometry
+  static inline Real product(const std::vector<const VariableValue *> & species,
+                             const std::vector<Real> & stoich,
+                             unsigned int qp)
+  {
+    if (species.size() == 0)
+      return 0.0;
+    Real prod = 1.0;
+    for (unsigned int i = 0; i < species.size(); ++i)
+      prod *= std::pow((*species[i])[qp], stoich[i]);
+    return prod;
+  }
+
+  /// Function to compute the derivative of the product with respect to the given variable
+  static inline Real productDerivative(const std::vector<const VariableValue *> & species,
+                                       const std::vector<Real> & stoich,
+                                       const std::vector<unsigned int> & vars,
+                                       unsigned int jvar,
+                                       unsigned int qp)
+  {
+    Real deriv = 0.0;
+    for (unsigned int i = 0; i < species.size(); ++i)
+    {
+      if (vars[i] != jvar)
+        continue;
+      Real term = stoich[i] * std::pow((*species[i])[qp], stoich[i] - 1.0);
+      for (unsigned int k = 0; k < species.size(); ++k)
+      {
+        if (k != i)
+          term *= std::pow((*species[k])[qp], stoich[k]);
+      }
+      deriv += term;
+    }
+    return deriv;
+  }
+};
+
+/// NoInhibition policy for the RateLawReaction kernel template
+class NoInhibition
+{
+public:
+  /// True if the rate constants are divided by coupled inhibition terms
+  static const bool inhibited = false;
+
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & /*params*/) {}
+};
+
+/// CoupledInhibition policy for the RateLawReaction kernel template
+/** Divides the forward and reverse rate constants by coupled inhibition terms (same as
+    InhibitedArrheniusReaction). */
+class CoupledInhibition
+{
+public:
+  /// True if the rate constants are divided by coupled inhibition terms
+  static const bool inhibited = true;
+
+  /// Function to add the parameters of the policy
+  static void addParams(InputParameters & params);
+};
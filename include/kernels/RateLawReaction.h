@@ -0,0 +1,126 @@
+/*!
+ *  \file RateLawReaction.h
+ *    \brief Kernel template for reactions composed from rate law policies
+ *    \details This file creates a kernel template for reactions composed from a rate constant
+ * policy, a concentration policy, and an inhibition policy (see RateLawPolicies). The composed
+ * kernels use the same input parameters as the ConstReaction, ArrheniusReaction,
+ * InhibitedArrheniusReaction, EquilibriumReaction, and ArrheniusEquilibriumReaction kernels, and
+ * are registered with a 'RateLaw' prefix on those names.
+ *
+ *            Unlike the inheritance chain of the original kernels, the rate constants and
+ *            concentration products are computed once per quadrature point before the residual or
+ *            Jacobian of each element is formed, and the per-qp residual and Jacobian functions
+ *            only combine the stored values.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "RateLawPolicies.h"
+
+/// RateLawReaction class template inherits from Kernel object
+/** This class template composes a reaction kernel from a rate constant policy (e.g.,
+    ArrheniusRateConstants), a concentration policy (e.g., PowerLawConcentrations), and an
+    inhibition policy (e.g., CoupledInhibition). The policies are resolved at compile time,
+    and the rate constants and concentration products are computed once per quadrature point
+    on each element (instead of once per test and trial function). The input parameters are
+    the same as those of the kernel the composition replaces. */
+template <class RateConstants, class Concentrations, class Inhibition>
+class RateLawReaction : public Kernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  RateLawReaction(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the rate constants and concentration products at all quadrature points
+  void computeRateTerms();
+
+  /// Function to compute the derivatives of the concentration products at all quadrature points
+  void computeSpeciesDerivatives(unsigned int jvar);
+
+  /// Called before the residual is computed on each element
+  virtual void precalculateResidual() override;
+
+  /// Called before the Jacobian is computed on each element
+  virtual void precalculateJacobian() override;
+
+  /// Called before the off diagonal Jacobian is computed on each element
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const RateConstants _rate_constants;           ///< Policy for the rate constants
+  Real _scale;                                   ///< Scaling parameter for the reaction
+  std::vector<Real> _react_stoich;               ///< Reactant list stoichiometries
+  std::vector<Real> _prod_stoich;                ///< Product list stoichiometries
+  std::vector<const VariableValue *> _reactants; ///< Pointer list to the coupled reactants
+  std::vector<const VariableValue *> _products;  ///< Pointer list to the coupled products
+  std::vector<unsigned int> _react_vars;         ///< Indices for the coupled reactants
+  std::vector<unsigned int> _prod_vars;          ///< Indices for the coupled products
+  const unsigned int _main_var;                  ///< Variable identification for the main variable
+  const VariableValue * _temp;                   ///< Coupled temperature variable (K) [optional]
+  unsigned int _temp_var;                        ///< Variable identification for temperature
+  const VariableValue * _forward_inhibition;     ///< Coupled forward inhibition variable [optional]
+  unsigned int _Rf_var;                          ///< Variable identification for Rf
+  const VariableValue * _reverse_inhibition;     ///< Coupled reverse inhibition variable [optional]
+  unsigned int _Rr_var;                          ///< Variable identification for Rr
+
+  std::vector<Real> _kf;         ///< Forward rate constant at each qp
+  std::vector<Real> _kr;         ///< Reverse rate constant at each qp
+  std::vector<Real> _dkf_dT;     ///< Temperature derivative of the forward rate constant at each qp
+  std::vector<Real> _dkr_dT;     ///< Temperature derivative of the reverse rate constant at each qp
+  std::vector<Real> _react_prod; ///< Concentration product of the reactants at each qp
+  std::vector<Real> _prod_prod;  ///< Concentration product of the products at each qp
+  std::vector<Real> _dreact;     ///< Derivative of the reactant product at each qp
+  std::vector<Real> _dprod;      ///< Derivative of the product product at each qp
+
+private:
+};
+
+/// Reaction kernel with constant rate constants (replaces ConstReaction)
+typedef RateLawReaction<ConstantRateConstants, PowerLawConcentrations, NoInhibition>
+    RateLawConstReaction;
+
+/// Reaction kernel with Arrhenius rate constants (replaces ArrheniusReaction)
+typedef RateLawReaction<ArrheniusRateConstants, PowerLawConcentrations, NoInhibition>
+    RateLawArrheniusReaction;
+
+/// Reaction kernel with inhibited Arrhenius rate constants (replaces InhibitedArrheniusReaction)
+typedef RateLawReaction<ArrheniusRateConstants, PowerLawConcentrations, CoupledInhibition>
+    RateLawInhibitedArrheniusReaction;
+
+/// Reaction kernel for an equilibrium reaction (replaces EquilibriumReaction)
+typedef RateLawReaction<EquilibriumRateConstants, PowerLawConcentrations, NoInhibition>
+    RateLawEquilibriumReaction;
+
+/// Reaction kernel for an Arrhenius equilibrium reaction (replaces ArrheniusEquilibriumReaction)
+typedef RateLawReaction<ArrheniusEquilibriumRateConstants, PowerLawConcentrations, NoInhibition>
+    RateLawArrheniusEquilibriumReaction;
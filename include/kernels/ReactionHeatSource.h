@@ -0,0 +1,78 @@
+/*!
+ *  \file ReactionHeatSource.h
+ *    \brief Kernel for the heat of a set of reactions from reaction rate materials
+ *    \details This file creates a kernel for the heat of a set of reactions added to an energy
+ * balance. The residual is the same as the sum of the ArrheniusReactionEnergyTransfer kernels over
+ * all reactions, Res = fv * av * sum(dH_j * r_j), where fv = volume fraction, av = specific area
+ * (optional), dH_j = reaction enthalpy, and r_j = reaction rate.
+ *
+ *            The rates (and their derivatives with respect to temperature and species) are material
+ *            properties (e.g., from the ArrheniusReactionRate material), so they are evaluated once
+ *            per quadrature point and shared with the species balances (see ReactionRateSum)
+ *            instead of being recomputed by one energy kernel per reaction.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
+
+/// ReactionHeatSource class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+    All public and protected members of this class are required function overrides.
+    The kernel adds the heat of a set of reactions to an energy balance using the
+    reaction rate material properties (e.g., from the ArrheniusReactionRate material),
+    so the rates are not computed again for the energy balance. */
+class ReactionHeatSource : public DerivativeMaterialInterface<Kernel>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ReactionHeatSource(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the sum of the reaction enthalpies times the rates at the current qp
+  Real computeHeatSum();
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  std::vector<Real> _enthalpy;                           ///< Reaction enthalpies (J/mol)
+  std::vector<const MaterialProperty<Real> *> _rates;    ///< Pointer list to the rates
+  std::vector<const MaterialProperty<Real> *> _drate_du; ///< Rate derivatives for this variable
+  std::vector<unsigned int> _arg_vars;                   ///< Indices for the coupled variables
+  std::vector<std::vector<const MaterialProperty<Real> *>>
+      _drate_darg;                  ///< Rate derivatives for the coupled variables [arg][rate]
+  const VariableValue & _volfrac;   ///< Variable for volume fraction (-)
+  const unsigned int _volfrac_var;  ///< Variable identification for volume fraction
+  const VariableValue & _specarea;  ///< Variable for specific area (m^-1) [optional]
+  const unsigned int _specarea_var; ///< Variable identification for specific area
+
+private:
+};
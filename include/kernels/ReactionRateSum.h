@@ -0,0 +1,75 @@
+/*!
+ *  \file ReactionRateSum.h
+ *    \brief Kernel for a stoichiometric weighted sum of reaction rate materials
+ *    \details This file creates a kernel for the sum of a set of reaction rate material properties
+ * weighted by their stoichiometry (and optionally scaled by a variable, such as the solids
+ * fraction). The residual is the same as the ScaledWeightedCoupledSumFunction kernel, but the rates
+ * are material properties (e.g., from ArrheniusReactionRate) instead of non-linear variables.
+ *
+ *            The Jacobian uses the derivatives of the rates declared by the rate materials. The
+ *            derivatives with respect to the variable of this kernel are always used, while
+ *            off-diagonal terms are only added for variables in the coupled_variables list.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "DerivativeMaterialInterface.h"
+
+/// ReactionRateSum class object inherits from Kernel object
+/** This class object inherits from the Kernel object in the MOOSE framework.
+    All public and protected members of this class are required function overrides.
+    The kernel sums a list of reaction rate material properties (e.g., from the
+    ArrheniusReactionRate material) weighted by their stoichiometry, with variable
+    scaling. This replaces a ScaledWeightedCoupledSumFunction over rate variables. */
+class ReactionRateSum : public DerivativeMaterialInterface<Kernel>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ReactionRateSum(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the weighted sum of the rates at the current qp
+  Real computeRateSum();
+
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  std::vector<Real> _weight;                             ///< Stoichiometric weight of each rate
+  std::vector<const MaterialProperty<Real> *> _rates;    ///< Pointer list to the rates
+  std::vector<const MaterialProperty<Real> *> _drate_du; ///< Rate derivatives for this variable
+  std::vector<unsigned int> _arg_vars;                   ///< Indices for the coupled variables
+  std::vector<std::vector<const MaterialProperty<Real> *>>
+      _drate_darg;               ///< Rate derivatives for the coupled variables [arg][rate]
+  const VariableValue & _scale;  ///< Scaling variable
+  const unsigned int _scale_var; ///< Variable identification for the scaling variable
+
+private:
+};
@@ -0,0 +1,124 @@
+/*!
+ *  \file ReactionSensitivity.h
+ *    \brief Kernel template for the forward sensitivity terms of reaction kernels
+ *    \details This file creates a kernel template that adds the forward sensitivity pieces to a
+ * reaction kernel (ConstReaction, ArrheniusReaction, or InhibitedArrheniusReaction). The template
+ * couples one sensitivity variable (s = dC/dp) for each reactant and product and gives the tangent
+ * of the reaction residual along those variables (i.e., sum(i, dRes/dC_i * s_i)) together with the
+ * derivatives of that tangent with respect to the species. It also gives the derivatives of
+ * Arrhenius rate constants with respect to their parameters and temperature.
+ *
+ *            The sensitivity kernels (e.g., ConstReactionSensitivity) inherit from this template
+ *            instead of from their reaction kernel directly, so that the plain reaction kernels do
+ *            not carry any of the sensitivity functions or coupled variables.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ConstReaction.h"
+
+/// ReactionSensitivity class template inherits from a reaction kernel
+/** This class template inherits from one of the reaction kernels (given as the template
+    argument) and adds the coupled sensitivity variables and the functions needed to form
+    the forward sensitivity residual of that reaction and its Jacobian. It is not registered
+    by itself; the sensitivity kernels inherit from it. */
+template <class Reaction>
+class ReactionSensitivity : public Reaction
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ReactionSensitivity(const InputParameters & parameters);
+
+  /// Function override to return false, since the coefficients depend on the species
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Function to compute the tangent rate (i.e., sum of dRes/dC_i * s_i over all species)
+  Real computeQpTangentRate();
+
+  /// Function to compute the coefficient of the given sensitivity variable in the tangent rate
+  Real computeQpTangentRateJacobian(unsigned int jvar);
+
+  /// Function to compute the second derivative of the reactant product (i-th and m-th reactant)
+  Real computeReactantProductSecondDerivative(unsigned int i, unsigned int m);
+
+  /// Function to compute the second derivative of the product product (i-th and m-th product)
+  Real computeProductProductSecondDerivative(unsigned int i, unsigned int m);
+
+  /// Function to compute the derivative of the reactant product with respect to the given variable
+  /** Returns zero if the variable is not one of the reactants. */
+  Real computeReactantProductVariableDerivative(unsigned int jvar);
+
+  /// Function to compute the derivative of the product product with respect to the given variable
+  /** Returns zero if the variable is not one of the products. */
+  Real computeProductProductVariableDerivative(unsigned int jvar);
+
+  /// Function to compute the reactant tangent (i.e., sum of dR/dC_i * s_i over all reactants)
+  Real computeReactantTangent();
+
+  /// Function to compute the product tangent (i.e., sum of dP/dC_i * s_i over all products)
+  Real computeProductTangent();
+
+  /// Function to compute the derivative of the reactant tangent with respect to the given variable
+  Real computeReactantTangentVariableDerivative(unsigned int jvar);
+
+  /// Function to compute the derivative of the product tangent with respect to the given variable
+  Real computeProductTangentVariableDerivative(unsigned int jvar);
+
+  /// Function to compute the derivative of the sensitivity residual with respect to a species
+  /** The sensitivity residual (per test function) is -scale*(kf*dR + R*dkf) + scale*(kr*dP +
+      P*dkr), where dR and dP are the reactant and product tangents, and dkf and dkr are the
+      derivatives of the rate constants along the sensitivity (given by the caller). */
+  Real computeQpSpeciesSensitivityJacobian(unsigned int jvar, Real kf_dot, Real kr_dot);
+
+  /// Function to compute the derivative of a rate constant with respect to one of its parameters
+  /** The param argument selects the parameter (0 = pre-exponential, 1 = activation energy,
+      2 = beta) and the derivative returned is for a rate constant of A * T^B * exp(-E/R/T). */
+  static Real computeRateConstantParameterDerivative(
+      Real temp, Real pre_exp, Real act_energy, Real beta, unsigned int param);
+
+  /// Function to compute the temperature derivative of a rate constant divided by the rate constant
+  /** For a rate constant of A * T^B * exp(-E/R/T) this is E/R/T^2 + B/T. */
+  static Real computeTemperatureFactor(Real temp, Real act_energy, Real beta);
+
+  /// Function to compute the derivative of the temperature factor with respect to temperature
+  static Real computeTemperatureFactorDerivative(Real temp, Real act_energy, Real beta);
+
+  /// Function to compute the temperature derivative of computeRateConstantParameterDerivative
+  static Real computeRateConstantParameterTemperatureDerivative(
+      Real temp, Real pre_exp, Real act_energy, Real beta, unsigned int param);
+
+  using Reaction::_forward_rate;
+  using Reaction::_prod_stoich;
+  using Reaction::_prod_vars;
+  using Reaction::_products;
+  using Reaction::_qp;
+  using Reaction::_react_stoich;
+  using Reaction::_react_vars;
+  using Reaction::_reactants;
+  using Reaction::_reverse_rate;
+  using Reaction::_scale;
+  using Reaction::computeProductProductDerivative;
+  using Reaction::computeReactantProductDerivative;
+
+  std::vector<const VariableValue *> _react_sens; ///< Pointer list to the reactant sensitivities
+  std::vector<const VariableValue *> _prod_sens;  ///< Pointer list to the product sensitivities
+  std::vector<unsigned int> _react_sens_vars;     ///< Indices for the reactant sensitivities
+  std::vector<unsigned int> _prod_sens_vars;      ///< Indices for the product sensitivities
+
+private:
+};
@@ -0,0 +1,71 @@
+/*!
+ *  \file SUPGArrheniusReaction.h
+ *    \brief SUPG stabilized kernel for a reaction with Arrhenius rate constants
+ *    \details This file creates a reaction kernel with the consistent SUPG stabilization term. The
+ * kernel gives the residual of ArrheniusReaction with the test function replaced by (test + tau *
+ * (v * grad(test))).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrheniusReaction.h"
+#include "SUPGStabilization.h"
+
+/// SUPGArrheniusReaction class object inherits from ArrheniusReaction and SUPGStabilization
+/** This class object adds the consistent streamline upwind stabilization term to the
+    ArrheniusReaction kernel. This kernel must be used together with the SUPG advection
+    kernels so that the stabilized form remains consistent. A reaction with constant rates
+    is given by setting the activation energies and temperature exponents to zero. */
+class SUPGArrheniusReaction : public ArrheniusReaction, public SUPGStabilization
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SUPGArrheniusReaction(const InputParameters & parameters);
+
+  /// Function override to return false, since the SUPG test functions are not checked for linearity
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. The
+   stabilization parameter is treated as a constant in the Jacobian. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Function to compute the SUPG weighting (tau * v * grad(test)) at the current qp
+  Real computeSUPGWeight();
+
+  /// Function to compute the derivative of the reaction rate with respect to a species
+  Real computeQpRateDerivative(unsigned int jvar);
+
+  RealVectorValue _velocity;          ///< Velocity vector
+  const VariableValue & _ux;          ///< Velocity in the x-direction
+  const VariableValue & _uy;          ///< Velocity in the y-direction
+  const VariableValue & _uz;          ///< Velocity in the z-direction
+  const VariableValue & _diffusivity; ///< Diffusivity for the local Peclet number
+
+private:
+};
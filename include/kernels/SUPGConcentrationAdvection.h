@@ -0,0 +1,57 @@
+/*!
+ *  \file SUPGConcentrationAdvection.h
+ *    \brief SUPG stabilized kernel for advection of a concentration
+ *    \details This file creates a continuous Galerkin kernel for the advection of a species with
+ * SUPG stabilization. The kernel gives the residual of GConcentrationAdvection plus the
+ * stabilization term: Res += tau * (v * grad(test)) * (v * grad(u)).
+ *
+ *            This kernel should be used with SUPGVariableCoefTimeDerivative and SUPG reaction
+ *            kernels on the same variable so that the stabilized formulation stays consistent.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GConcentrationAdvection.h"
+#include "SUPGStabilization.h"
+
+/// SUPGConcentrationAdvection class object inherits from GConcentrationAdvection
+/** This class object adds the streamline upwind stabilization term to the
+    GConcentrationAdvection kernel so that it can be used in a continuous Galerkin
+    formulation without the DGConcentrationAdvection kernel. */
+class SUPGConcentrationAdvection : public GConcentrationAdvection, public SUPGStabilization
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SUPGConcentrationAdvection(const InputParameters & parameters);
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+    computed is the associated diagonal element in the overall Jacobian matrix for the
+    system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Function to compute the SUPG weighting (tau * v * grad(test)) at the current qp
+  Real computeSUPGWeight();
+
+  const VariableValue & _diffusivity; ///< Diffusivity for the local Peclet number
+
+private:
+};
@@ -0,0 +1,65 @@
+/*!
+ *  \file SUPGPoreConcAdvection.h
+ *    \brief SUPG stabilized kernel for advection in the pore space of a domain
+ *    \details This file creates a continuous Galerkin kernel for the advection of a species in the
+ * pore space of a domain with SUPG stabilization. The kernel gives the residual of
+ * GPoreConcAdvection plus the stabilization term: Res += tau * (v * grad(test)) * porosity * (v *
+ * grad(u)).
+ *
+ *            This kernel should be used with SUPGVariableCoefTimeDerivative and SUPG reaction
+ *            kernels on the same variable so that the stabilized formulation stays consistent.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GPoreConcAdvection.h"
+#include "SUPGStabilization.h"
+
+/// SUPGPoreConcAdvection class object inherits from GPoreConcAdvection and SUPGStabilization
+/** This class object adds the streamline upwind stabilization term to the GPoreConcAdvection
+    kernel so that it can be used in a continuous Galerkin formulation without the
+    DGPoreConcAdvection kernel. */
+class SUPGPoreConcAdvection : public GPoreConcAdvection, public SUPGStabilization
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SUPGPoreConcAdvection(const InputParameters & parameters);
+
+  /// Function override to return false, since the SUPG test functions are not checked for linearity
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+    computed is the associated diagonal element in the overall Jacobian matrix for the
+    system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. The
+    stabilization parameter is treated as a constant in the Jacobian. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Function to compute the SUPG weighting (tau * v * grad(test)) at the current qp
+  Real computeSUPGWeight();
+
+  const VariableValue & _diffusivity; ///< Diffusivity for the local Peclet number
+
+private:
+};
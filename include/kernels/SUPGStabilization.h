@@ -0,0 +1,55 @@
+/*!
+ *  \file SUPGStabilization.h
+ *    \brief Base class for the streamline upwind stabilization of continuous Galerkin kernels
+ *    \details This file creates a base class that gives a common set of parameters and a common
+ * stabilization parameter (tau) for the streamline upwind Petrov-Galerkin (SUPG) kernels. In the
+ * SUPG method, the test function of every term in the transport equation is replaced by
+ * (test + tau * v * grad(test)), which adds the stabilization of an upwind method to a continuous
+ * Galerkin formulation without the face kernels and extra unknowns of the DG method.
+ *
+ *            The stabilization parameter is computed in each element from the local Peclet number
+ *            and can be tuned by the user with the tau_scale parameter.
+ *
+ *            Reference: A.N. Brooks and T.J.R. Hughes, Streamline upwind/Petrov-Galerkin
+ *            formulations for convection dominated flows, Comput. Methods Appl. Mech. Engrg. 32
+ *            (1982) 199-259.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+
+/// SUPGStabilization class object for the stabilization parameter of SUPG kernels
+/** This class object is not a MOOSE object by itself. It is inherited (along with a standard
+    kernel) by each of the SUPG kernels to give a common set of parameters and a common
+    stabilization parameter (tau) that is computed from the local Peclet number of each
+    element. Each SUPG kernel must call addSUPGParams in its validParams. */
+class SUPGStabilization
+{
+public:
+  /// Function to add the stabilization parameters to a derived SUPG kernel
+  static void addSUPGParams(InputParameters & params);
+
+  /// Constructor for the SUPG parameters
+  SUPGStabilization(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the stabilization parameter for the given velocity and element size
+  /** The parameter is computed from the local Peclet number (Pe = |v| * h / 2 / D) as
+      tau = tau_scale * h / 2 / |v| * (coth(Pe) - 1/Pe). This gives the exact nodal
+      solution for 1D steady advection-diffusion with linear elements. */
+  Real computeTau(const RealVectorValue & velocity, Real diffusivity, Real h) const;
+
+  Real _tau_scale; ///< User defined scaling factor for the stabilization parameter
+};
@@ -0,0 +1,60 @@
+/*!
+ *  \file SUPGVariableCoefTimeDerivative.h
+ *    \brief SUPG stabilized time derivative with a variable coefficient
+ *    \details This file creates a time derivative kernel that is multiplied by another variable as
+ * the coefficient, with the consistent SUPG stabilization term: Res = (test + tau * (v *
+ * grad(test))) * coef * du/dt. Use coupled_coef = 1 for a plain time derivative.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "VariableCoefTimeDerivative.h"
+#include "SUPGStabilization.h"
+
+/// SUPGVariableCoefTimeDerivative class object inherits from VariableCoefTimeDerivative
+/**
+ * Time derivative term multiplied by another variable as the coefficient, with the
+ *  consistent streamline upwind stabilization term. This kernel must be used together
+ *  with the SUPG advection kernels so that the stabilized form remains consistent.
+ */
+class SUPGVariableCoefTimeDerivative : public VariableCoefTimeDerivative,
+                                       public SUPGStabilization
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  SUPGVariableCoefTimeDerivative(const InputParameters & parameters);
+
+  /// Function override to return false, since the SUPG test functions are not checked for linearity
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  virtual Real computeQpResidual() override;
+  /// Required Jacobian function for standard kernels in MOOSE
+  virtual Real computeQpJacobian() override;
+  /// Off diagonal Jacobian for the coupled coefficient (tau is treated as a constant)
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Function to compute the SUPG weighting (tau * v * grad(test)) at the current qp
+  Real computeSUPGWeight();
+
+  RealVectorValue _velocity;          ///< Velocity vector
+  const VariableValue & _ux;          ///< Velocity in the x-direction
+  const VariableValue & _uy;          ///< Velocity in the y-direction
+  const VariableValue & _uz;          ///< Velocity in the z-direction
+  const VariableValue & _diffusivity; ///< Diffusivity for the local Peclet number
+};
@@ -0,0 +1,83 @@
+/*!
+ *  \file TransformedArrheniusReaction.h
+ *    \brief Arrhenius reaction kernel with species solved in transformed variables
+ *    \details This file creates a reaction kernel with Arrhenius rate constants where some of the
+ * reactants and/or products are solved in transformed variables. The concentrations of the
+ * transformed species are computed once per element before the residual and Jacobian are evaluated,
+ * and the rate is given by the residual of ArrheniusReaction. Jacobian entries for the transformed
+ * species are multiplied by C'(w) from the chain rule.
+ *
+ *            Species in the transformed_species list must use the same transformation as this
+ *            kernel.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrheniusReaction.h"
+#include "ConcentrationTransform.h"
+
+/// TransformedArrheniusReaction class object inherits from ArrheniusReaction object
+/** This class object gives the rate of ArrheniusReaction when some of the reactants and/or
+    products are solved in transformed variables. The concentrations of those species are
+    computed from the transformed variables before the rate is evaluated, and the Jacobian
+    entries for them are multiplied by C'(w). */
+class TransformedArrheniusReaction : public ArrheniusReaction, public ConcentrationTransform
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TransformedArrheniusReaction(const InputParameters & parameters);
+
+  /// Function override to return false, since the species are solved in transformed variables
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+  /// Destructor to release the concentrations of the transformed species
+  virtual ~TransformedArrheniusReaction();
+
+protected:
+  /// Function to compute the concentrations of the transformed species at all quadrature points
+  void computeTransformedConcentrations();
+
+  /// Function to give the derivative C'(w) for the given variable (1 if not transformed)
+  Real transformedDerivative(unsigned int jvar);
+
+  /// Called before the residual is computed on each element
+  virtual void precalculateResidual() override;
+
+  /// Called before the Jacobian is computed on each element
+  virtual void precalculateJacobian() override;
+
+  /// Called before the off diagonal Jacobian is computed on each element
+  virtual void precalculateOffDiagJacobian(unsigned int jvar) override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  std::vector<const VariableValue *> _trans; ///< Pointer list to the transformed species
+  std::vector<unsigned int> _trans_vars;     ///< Indices for the transformed species
+  std::vector<VariableValue> _trans_conc;    ///< Concentrations of the transformed species
+
+private:
+};
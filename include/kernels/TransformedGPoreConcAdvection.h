@@ -0,0 +1,57 @@
+/*!
+ *  \file TransformedGPoreConcAdvection.h
+ *    \brief Advection kernel for a species solved in a transformed variable
+ *    \details This file creates an advection kernel for a species solved in a transformed variable
+ * w, i.e., Res = -eps * C(w) * (v * grad(test)). This kernel is the transformed version of
+ * GPoreConcAdvection and is used with the same boundary conditions written for the concentration
+ * (C(w) at boundaries).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GPoreConcAdvection.h"
+#include "ConcentrationTransform.h"
+
+/// TransformedGPoreConcAdvection class object inherits from GPoreConcAdvection object
+/** This class object gives the advection of a concentration in the pores for a species that
+    is solved in a transformed variable w, i.e., the advected concentration is C(w). */
+class TransformedGPoreConcAdvection : public GPoreConcAdvection, public ConcentrationTransform
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TransformedGPoreConcAdvection(const InputParameters & parameters);
+
+  /// Function override to return false, since the species is solved in a transformed variable
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+    computed is the associated diagonal element in the overall Jacobian matrix for the
+    system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+    returning a non-zero value we will hopefully improve the convergence rate for the
+    cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+};
@@ -0,0 +1,66 @@
+/*!
+ *  \file TransformedVariableCoefTimeDerivative.h
+ *    \brief Time derivative kernel for a species solved in a transformed variable
+ *    \details This file creates a time derivative kernel for a species solved in a transformed
+ * variable w, i.e., Res = coef * (C(w) - C(w_old)) / dt * test. The change in concentration over
+ * the step is used (instead of C'(w) * dw/dt) so that mass is conserved for large time steps with
+ * implicit Euler. The transformation is set with the ConcentrationTransform parameters.
+ *
+ *            The difference (C(w) - C(w_old)) / dt is the backward Euler derivative of C, and the
+ *            time integrator is bypassed for this term. Only the implicit-euler scheme is valid
+ *            with this kernel; with other schemes (e.g., bdf2 or crank-nicolson) the accumulation
+ *            of the species does not match the rest of the balance.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "VariableCoefTimeDerivative.h"
+#include "ConcentrationTransform.h"
+
+/// TransformedVariableCoefTimeDerivative class object inherits from VariableCoefTimeDerivative
+/** This class object gives the time derivative of a concentration (coef * dC/dt) for a
+    species that is solved in a transformed variable w. The derivative is taken as the
+    change in the concentration over the step, i.e., coef * (C(w) - C(w_old)) / dt, so that
+    mass is conserved for large steps. This is the implicit Euler form of the derivative, so
+    it should only be used with the implicit-euler time scheme. */
+class TransformedVariableCoefTimeDerivative : public VariableCoefTimeDerivative,
+                                              public ConcentrationTransform
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TransformedVariableCoefTimeDerivative(const InputParameters & parameters);
+
+  /// Function override to return false, since the species is solved in a transformed variable
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
+protected:
+  /// Required residual function for standard kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+  /// Required Jacobian function for standard kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+    computed is the associated diagonal element in the overall Jacobian matrix for the
+    system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+    returning a non-zero value we will hopefully improve the convergence rate for the
+    cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const VariableValue & _u_old; ///< Transformed variable at the previous time step
+};
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "CoefTimeDerivative.h"
+#include "LinearityInterface.h"
 
 /// VariableCoefTimeDerivative class object inherits from CoefTimeDerivative object
 /**
@@ -28,7 +29,7 @@
  *  This will be useful for domains that have a pososity that varies in space
  *  and time.
  */
-class VariableCoefTimeDerivative : public CoefTimeDerivative
+class VariableCoefTimeDerivative : public CoefTimeDerivative, public LinearityInterface
 {
 public:
   /// Required new syntax for InputParameters
@@ -37,6 +38,10 @@ public:
   /// Required constructor for objects in MOOSE
   VariableCoefTimeDerivative(const InputParameters & parameters);
 
+  /// Function to return true if the residual is linear in the variables of the given system
+  /** The residual is only linear if the coefficient is not one of the unknowns. */
+  virtual bool isLinearInUnknowns(const SystemBase & sys) const override;
+
 protected:
   /// Required residual function for standard kernels in MOOSE
   /** This function returns a residual contribution for this object.*/
@@ -52,6 +57,17 @@ protected:
     cross coupling of the variables. */
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  const VariableValue & _coupled;  ///< Coupled non-linear variable
-  const unsigned int _coupled_var; ///< Variable identification for _coupled
+  /// Function to give the time derivative of the variable for the current test function
+  /** Returns the value at the current qp, or the nodal value of the current test function
+      if the mass is lumped. */
+  Real timeDerivativeValue();
+
+  /// Function to give the trial function of the time derivative for the Jacobian
+  /** Returns the value at the current qp, or the Kronecker delta if the mass is lumped. */
+  Real massTrialFunction();
+
+  const VariableValue & _coupled;     ///< Coupled non-linear variable
+  const unsigned int _coupled_var;    ///< Variable identification for _coupled
+  const bool _lumped;                 ///< True if the mass is lumped to the nodes
+  const VariableValue & _u_dot_nodal; ///< Time derivative of the variable at the nodes
 };
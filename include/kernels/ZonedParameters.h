@@ -0,0 +1,62 @@
+/*!
+ *  \file ZonedParameters.h
+ *    \brief Helper class for kernels with per-subdomain (zoned) parameters
+ *    \details This file creates a helper class that is inherited by reaction and transfer kernels
+ * to give per-subdomain (i.e., zoned catalyst) values of their parameters. The user lists the zones
+ * (subdomain names) and gives a table with one value per zone for each parameter that changes
+ * between zones. The zone index of the current subdomain is looked up once each time the kernel
+ * enters a new subdomain and the parameters are set from the tables, so a single kernel can serve
+ * all zones of a multi-block monolith.
+ *
+ *            Elements in subdomains that are not in the zones list use the base (non-zoned) value
+ *            of the parameter. Parameters that vary continuously in space should instead be given
+ *            as coupled auxiliary variables.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Kernel.h"
+#include "MooseMesh.h"
+
+/// ZonedParameters class object for kernels with parameters that change by subdomain
+/** This class object is not a MOOSE object by itself. It is inherited (along with a standard
+    kernel) by kernels that allow their parameters to be given per zone (i.e., subdomain).
+    Each zoned kernel must call addZoneParams in its validParams and call setCurrentZone
+    in its subdomainSetup before resolving its parameters with zoneValue. */
+class ZonedParameters
+{
+public:
+  /// Function to add the zone parameters to a derived kernel
+  static void addZoneParams(InputParameters & params);
+
+  /// Constructor for the zone parameters
+  ZonedParameters(const InputParameters & parameters, MooseMesh & mesh);
+
+protected:
+  /// Function to check that a zoned parameter table has one value per zone (or is empty)
+  void checkZoneTable(const std::vector<Real> & table, const std::string & name) const;
+
+  /// Function to set the index of the current zone from the current subdomain
+  void setCurrentZone(SubdomainID id);
+
+  /// Function to set a parameter from its zone table
+  /** The value is left unchanged if the table is empty. Otherwise, the value is set to the
+      table entry of the current zone, or to the base value if the current subdomain is not
+      one of the zones. */
+  void zoneValue(const std::vector<Real> & table, Real base, Real & value) const;
+
+  std::vector<SubdomainName> _zone_names; ///< Names of the subdomains for each zone
+  std::vector<SubdomainID> _zone_ids;     ///< Subdomain ids for each zone
+  int _current_zone;                      ///< Index of the current zone (-1 if not in a zone)
+};
@@ -0,0 +1,63 @@
+/*!
+ *  \file ArrheniusReactionRate.h
+ *    \brief Material for the rate of an Arrhenius reaction
+ *    \details This file creates a material for the rate of an Arrhenius reaction. The rate
+ * constants are computed as k = A * T^B * exp(-E/R/T), and the material declares the rate and its
+ * derivatives with respect to each coupled species and the temperature.
+ *
+ *            The rate is consumed by the species balances through the ReactionRateSum kernel and
+ *            replaces a rate variable with Reaction and ArrheniusReaction kernels.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ConstReactionRate.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// ArrheniusReactionRate class object inherits from ConstReactionRate object
+/** This class object inherits from the ConstReactionRate object in the MOOSE framework.
+    The rate constants are computed from the Arrhenius expression k = A * T^B * exp(-E/R/T)
+    and the material also provides the derivative of the rate with respect to temperature. */
+class ArrheniusReactionRate : public ConstReactionRate
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ArrheniusReactionRate(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  /// Function to compute the rate constants (and their temperature derivatives)
+  virtual void calculateRateConstants() override;
+
+  Real _act_energy_for;               ///< Activation energy forward (J/mol)
+  Real _act_energy_rev;               ///< Activation energy reverse (J/mol)
+  Real _pre_exp_for;                  ///< Pre-exponential factor forward (same units as kf)
+  Real _pre_exp_rev;                  ///< Pre-exponential factor reverse (same units as kr)
+  Real _beta_for;                     ///< Temperature exponential forward (-)
+  Real _beta_rev;                     ///< Temperature exponential reverse (-)
+  const VariableValue & _temp;        ///< Coupled temperature variable (K)
+  Real _dforward_rate_dT;             ///< Derivative of the forward rate constant with temperature
+  Real _dreverse_rate_dT;             ///< Derivative of the reverse rate constant with temperature
+  MaterialProperty<Real> & _drate_dT; ///< Derivative of the rate with respect to temperature
+
+private:
+};
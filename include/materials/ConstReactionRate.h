@@ -0,0 +1,71 @@
+/*!
+ *  \file ConstReactionRate.h
+ *    \brief Material for the rate of a reaction with constant rate constants
+ *    \details This file creates a material for the rate of a reaction with constant rate constants.
+ * The rate is r = kf*prod(reactants^stoich) - kr*prod(products^stoich) and is declared as a
+ * material property, along with its derivatives with respect to each coupled species (using the
+ * derivative naming of the DerivativeMaterialInterface).
+ *
+ *            The rate is then consumed by the species balances through the ReactionRateSum kernel,
+ *            so the reaction rate no longer needs to be a non-linear variable with its own Reaction
+ *            and ConstReaction kernels.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+/// ConstReactionRate class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+    The material computes the rate of a reaction (r = kf*prod(reactants) - kr*prod(products))
+    as a material property, along with the derivatives of the rate with respect to each of
+    the coupled species. This replaces a rate variable and its ConstReaction kernel. */
+class ConstReactionRate : public DerivativeMaterialInterface<Material>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ConstReactionRate(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  /// Function to compute the rate constants (and their temperature derivatives)
+  virtual void calculateRateConstants();
+
+  /// Function to return the index of the given variable in the unique species list
+  unsigned int speciesIndex(const VariableName & name);
+
+  const MaterialPropertyName _rate_name;         ///< Name of the rate material property
+  Real _forward_rate;                            ///< Rate constant for forward reaction
+  Real _reverse_rate;                            ///< Rate constant for reverse reaction
+  std::vector<Real> _react_stoich;               ///< Reactant list stoichiometries
+  std::vector<Real> _prod_stoich;                ///< Product list stoichiometries
+  std::vector<const VariableValue *> _reactants; ///< Pointer list to the coupled reactants
+  std::vector<const VariableValue *> _products;  ///< Pointer list to the coupled products
+  std::vector<unsigned int> _react_index;        ///< Index of reactants in the species list
+  std::vector<unsigned int> _prod_index;         ///< Index of products in the species list
+  std::vector<VariableName> _species;            ///< Unique list of species in the reaction
+  Real _react_prod;                              ///< Product of reactants raised to stoich
+  Real _prod_prod;                               ///< Product of products raised to stoich
+
+  MaterialProperty<Real> & _rate;                        ///< Reaction rate property
+  std::vector<MaterialProperty<Real> *> _drate_dspecies; ///< Rate derivatives for species
+
+private:
+};
@@ -0,0 +1,55 @@
+/*!
+ *  \file InhibitedArrheniusReactionRate.h
+ *    \brief Material for the rate of an inhibited Arrhenius reaction
+ *    \details This file creates a material for the rate of an inhibited Arrhenius reaction. The
+ * forward and reverse rate constants are divided by coupled inhibition terms, and the material
+ * declares the rate and its derivatives with respect to each coupled species, the temperature, and
+ * the inhibition terms.
+ *
+ *            The rate is consumed by the species balances through the ReactionRateSum kernel and
+ *            replaces a rate variable with Reaction and InhibitedArrheniusReaction kernels.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "ArrheniusReactionRate.h"
+
+/// InhibitedArrheniusReactionRate class object inherits from ArrheniusReactionRate object
+/** This class object inherits from the ArrheniusReactionRate object in the MOOSE framework.
+    The forward and reverse rate constants are divided by coupled inhibition terms (e.g., the
+    variables of a LangmuirInhibition kernel) and the material also provides the derivatives
+    of the rate with respect to the inhibition terms. */
+class InhibitedArrheniusReactionRate : public ArrheniusReactionRate
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  InhibitedArrheniusReactionRate(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  /// Function to compute the rate constants (and their temperature derivatives)
+  virtual void calculateRateConstants() override;
+
+  const VariableValue & _forward_inhibition; ///< Coupled forward inhibition variable (-)
+  const VariableValue & _reverse_inhibition; ///< Coupled reverse inhibition variable (-)
+  MaterialProperty<Real> * _drate_dRf;       ///< Derivative of the rate with respect to Rf
+  MaterialProperty<Real> * _drate_dRr;       ///< Derivative of the rate with respect to Rr
+
+private:
+};
@@ -0,0 +1,127 @@
+/*!
+ *  \file MechanismReactionRates.h
+ *    \brief Material for all reaction rates of a mechanism read from a file
+ *    \details This file creates a material that reads a reaction mechanism file and computes the
+ * rates of all reactions in the mechanism as material properties. The mechanism is given as blocks
+ * of keyword lines (comments start with #):
+ *
+ *              reaction r1
+ *                reactants  NO:2 O2       # species:stoichiometry (default stoichiometry is 1)
+ *                products   NO2:2
+ *                forward    1.0e5 0 42000 # A beta E, for k = A * T^beta * exp(-E/R/T)
+ *                reverse    2.0e3 0 12000 # (optional)
+ *                inhibition R_NO          # forward rate is divided by this variable (optional)
+ *              end
+ *
+ *            The reactions are compiled into tables when the material is constructed. Each unique
+ *            species power term (c^s) is computed once per quadrature point and shared by all
+ *            reactions that use it, as are the logarithm and inverse of the temperature, so one
+ *            material evaluates the whole mechanism. Each rate (named after its reaction) and its
+ *            derivatives with respect to the species, temperature, and inhibition variable are then
+ *            consumed by the ReactionRateSum and ReactionHeatSource kernels.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// MechanismReactionRates class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+    The material reads a reaction mechanism file, compiles the reactions into flat tables
+    of species power terms, and computes the rates of all reactions (and their derivatives)
+    as material properties in one pass per quadrature point. The rates are consumed by the
+    ReactionRateSum and ReactionHeatSource kernels. */
+class MechanismReactionRates : public DerivativeMaterialInterface<Material>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  MechanismReactionRates(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  /// Function to read the reactions from the mechanism file
+  void readMechanism(const std::string & file);
+
+  /// Function to read a list of species and stoichiometry (e.g., NO:2 O2:1) for a reaction
+  void readSpeciesList(std::istream & in,
+                       const std::string & reaction,
+                       std::vector<unsigned int> & species,
+                       std::vector<Real> & stoich);
+
+  /// Function to build the power term tables and declare the rate properties
+  void compileMechanism();
+
+  /// Function to return the index of the named species (error if not coupled)
+  unsigned int speciesIndex(const std::string & name, const std::string & reaction) const;
+
+  /// Function to return the index of the power term for the species and stoichiometry
+  unsigned int powerIndex(unsigned int species, Real stoich);
+
+  /// Function to compute the product of the power terms in the list
+  Real powerProduct(const std::vector<unsigned int> & powers) const;
+
+  /// Function to compute the derivative of the product of the power terms for a species
+  Real powerProductDerivative(const std::vector<unsigned int> & powers, unsigned int species) const;
+
+  /// Power term (c^s) shared by all reactions with the same species and stoichiometry
+  struct PowerTerm
+  {
+    unsigned int species; ///< Index of the species
+    Real stoich;          ///< Stoichiometry (i.e., power) of the species
+    int int_stoich;       ///< Stoichiometry if it is 1 or 2 (-1 otherwise)
+  };
+
+  /// Reaction record from the mechanism file
+  struct MechanismReaction
+  {
+    std::string name;                                     ///< Name of the reaction (rate property)
+    std::vector<unsigned int> react_species;              ///< Indices of the reactants
+    std::vector<Real> react_stoich;                       ///< Reactant stoichiometries
+    std::vector<unsigned int> prod_species;               ///< Indices of the products
+    std::vector<Real> prod_stoich;                        ///< Product stoichiometries
+    Real pre_exp[2];                                      ///< Pre-exponential factors [for, rev]
+    Real beta[2];                                         ///< Temperature exponentials [for, rev]
+    Real act_energy[2];                                   ///< Activation energy [for, rev] (J/mol)
+    int inhibition;                                       ///< Inhibition variable index (-1 = none)
+    std::vector<unsigned int> react_powers;               ///< Indices of reactant power terms
+    std::vector<unsigned int> prod_powers;                ///< Indices of product power terms
+    std::vector<unsigned int> deriv_species;              ///< Species the rate depends on
+    MaterialProperty<Real> * rate;                        ///< Rate property
+    std::vector<MaterialProperty<Real> *> drate_dspecies; ///< Rate derivatives (deriv_species)
+    MaterialProperty<Real> * drate_dT;                    ///< Rate derivative for temperature
+    MaterialProperty<Real> * drate_dinhib;                ///< Rate derivative for inhibition
+  };
+
+  std::vector<const VariableValue *> _species;    ///< Pointer list to the coupled species
+  std::vector<VariableName> _species_names;       ///< Names of the coupled species
+  std::vector<const VariableValue *> _inhibitors; ///< Pointer list to the inhibition variables
+  std::vector<VariableName> _inhibitor_names;     ///< Names of the inhibition variables
+  const VariableValue & _temp;                    ///< Coupled temperature variable (K)
+  std::vector<MechanismReaction> _reactions;      ///< Reactions read from the mechanism file
+  std::vector<PowerTerm> _power_terms;            ///< Unique power terms of all reactions
+  std::vector<Real> _pow;                         ///< Value of each power term at the current qp
+  std::vector<Real> _dpow;                        ///< Derivative of each power term at the qp
+
+private:
+};
@@ -0,0 +1,60 @@
+/*!
+ *  \file PoreTransportHDGMaterial.h
+ *    \brief Custom material object to interface the pore transport equations with MOOSE HDG kernels
+ *    \details This file creates a custom materials object to interface the CATS pore transport
+ * equations with the hybridizable discontinuous Galerkin (HDG) kernels of the MOOSE framework. In
+ * the HDG method, the unknowns inside each element are statically condensed, so that only the trace
+ * unknowns on the faces of the mesh enter the global system. This gives a much smaller global
+ * system than the interior penalty DG kernels (DGPoreConcAdvection and DGVarPoreDiffusion) while
+ * keeping the local conservation of the DG method.
+ *
+ *            The MOOSE HDG kernels require the diffusivity and velocity to be material properties
+ *            instead of variables. In the same way as INSFluid, this material is used only to set
+ *            the material property values from the CATS variables, where the effective diffusivity
+ *            is (porosity * D) and the effective velocity is (porosity * v).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Material.h"
+
+/// PoreTransportHDGMaterial class object inherits from Material object
+/** This class object inherits from the Material object.
+    All public and protected members of this class are required function overrides.
+    The material sets the effective diffusivity and velocity of the pore transport
+    equations as material properties for use with the MOOSE HDG kernels. */
+class PoreTransportHDGMaterial : public Material
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  PoreTransportHDGMaterial(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  const VariableValue & _porosity; ///< CATS porosity variable (-)
+  const VariableValue & _D;        ///< CATS diffusivity variable (L^2/T)
+  const VariableValue & _ux;       ///< CATS velocity in the x-direction (L/T)
+  const VariableValue & _uy;       ///< CATS velocity in the y-direction (L/T)
+  const VariableValue & _uz;       ///< CATS velocity in the z-direction (L/T)
+
+  MaterialProperty<Real> & _diffusivity;         ///< HDG material for porosity * D (L^2/T)
+  MaterialProperty<RealVectorValue> & _velocity; ///< HDG material for porosity * v (L/T)
+
+private:
+};
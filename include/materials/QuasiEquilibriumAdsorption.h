@@ -0,0 +1,80 @@
+/*!
+ *  \file QuasiEquilibriumAdsorption.h
+ *    \brief Material for fast adsorption equilibria solved locally at each qp
+ *    \details This file creates a material for a set of fast adsorption equilibria on a common site
+ * (C_i + S <-- --> q_i, with the site balance S = Smax - sum(q_i)). Instead of solving the adsorbed
+ * species and open sites as non-linear variables (e.g., with EquilibriumReaction and
+ * MaterialBalance kernels), which forces small time steps or ill-conditioned Jacobians when the
+ * equilibria are fast, the equilibria are solved locally at each quadrature point as q_i = Smax *
+ * K_i * C_i / (1 + sum(K_j * C_j)) where K_i = exp(-dH_i/R/T + dS_i/R).
+ *
+ *            The adsorbed species are declared as (stateful) material properties, along with their
+ *            derivatives with respect to the species, temperature, and maximum capacity, and are
+ *            coupled to the species balances through the QuasiEquilibriumTimeDerivative kernel. The
+ *            user tags the fast equilibria by moving them from the reaction kernels to this
+ *            material.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This material was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+#ifndef lnKo
+#define lnKo(H, S, T) -(H / (Rstd * T)) + (S / Rstd)
+#endif
+
+/// QuasiEquilibriumAdsorption class object inherits from Material object
+/** This class object inherits from the Material object in the MOOSE framework.
+    The material replaces a set of fast adsorption equilibria on a common site
+    (i.e., C_i + S <-- --> q_i with S = Smax - sum(q_i)) with their local algebraic
+    solution, so the adsorbed species and the open sites are no longer non-linear
+    variables. The adsorbed species are declared as material properties (with their
+    derivatives) and are coupled to the species balances through the
+    QuasiEquilibriumTimeDerivative kernel. */
+class QuasiEquilibriumAdsorption : public DerivativeMaterialInterface<Material>
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  QuasiEquilibriumAdsorption(const InputParameters & parameters);
+
+protected:
+  /// Function to initialize the adsorbed species at equilibrium with the initial conditions
+  virtual void initQpStatefulProperties() override;
+
+  /// Function to compute the material properties at a quadrature point
+  virtual void computeQpProperties() override;
+
+  std::vector<const VariableValue *> _species; ///< Pointer list to the coupled species
+  std::vector<VariableName> _species_names;    ///< Names of the coupled species
+  std::vector<Real> _enthalpy;                 ///< Adsorption enthalpy of each species (J/mol)
+  std::vector<Real> _entropy;                  ///< Adsorption entropy of each species (J/K/mol)
+  const VariableValue & _max_capacity;         ///< Maximum capacity of the sites (mol/volume)
+  const VariableValue & _temp;                 ///< Coupled temperature variable (K)
+  std::vector<Real> _K;                        ///< Equilibrium constants at the current qp
+
+  std::vector<MaterialProperty<Real> *> _q;                  ///< Adsorbed species properties
+  std::vector<std::vector<MaterialProperty<Real> *>> _dq_dc; ///< Derivatives [ads][species]
+  std::vector<MaterialProperty<Real> *> _dq_dT;              ///< Derivatives with temperature
+  std::vector<MaterialProperty<Real> *> _dq_dSmax;           ///< Derivatives with max capacity
+
+private:
+};
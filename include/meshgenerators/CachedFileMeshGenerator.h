@@ -0,0 +1,51 @@
+/*!
+ *  \file CachedFileMeshGenerator.h
+ *    \brief Mesh generator that keeps a pre-partitioned binary cache of a mesh file
+ *    \details This file creates a mesh generator that reads a mesh file (Gmsh UNV or MSH, or any
+ * other format that libMesh can read) and stores the prepared, partitioned, and subdomain/boundary
+ * tagged mesh as a binary checkpoint in a cache directory. The cache is keyed by a hash of the
+ * contents of the mesh file and the number of processors. Repeated runs on the same geometry
+ * (e.g., parameter sweeps) then load the binary checkpoint with the stored partitioning instead of
+ * parsing and partitioning the mesh file again.
+ *
+ *  \note Only the mesh from the file is cached. Mesh generators that come after this one are
+ *        still run, and geometric auxiliary values are still computed by their aux kernels.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This mesh generator was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GmshUNVMeshGenerator.h"
+
+/// CachedFileMeshGenerator class object inherits from GmshUNVMeshGenerator object
+/** This class object creates a MeshGenerator for use in the MOOSE framework. The
+    object reads a mesh file and caches the partitioned mesh as a binary checkpoint. */
+class CachedFileMeshGenerator : public GmshUNVMeshGenerator
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  CachedFileMeshGenerator(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Function to compute the hash key of the mesh file contents
+  std::string fileHash() const;
+
+  std::string _directory; ///< Directory of the mesh cache
+  bool _rebuild;          ///< True if the cache is always written again
+};
@@ -0,0 +1,87 @@
+/*!
+ *  \file GmshUNVMeshGenerator.h
+ *    \brief Mesh generator to read Gmsh produced UNV (or MSH) files directly
+ *    \details This file creates a mesh generator that reads the UNV files exported by Gmsh
+ * without first converting them with scripts/python/utils/unv-converter.py. The element
+ * descriptors that Gmsh writes for beams (fe ids 21-24) are handled directly, both group dataset
+ * tags (2467 and 2477) are accepted, and node entities in groups are read as nodesets instead of
+ * being removed. Groups of the highest dimensional elements become named subdomains and groups of
+ * lower dimensional elements become named sidesets (matched to the sides of the volume elements).
+ *
+ *            The file is parsed once on the first processor and the mesh is then broadcast to
+ *            the other processors (the same as the libMesh readers), which avoids every processor
+ *            parsing the same text file. Gmsh MSH files are passed to the libMesh Gmsh reader
+ *            (with physical groups) in the same way.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This mesh generator was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "MeshGenerator.h"
+
+/// GmshUNVMeshGenerator class object inherits from MeshGenerator object
+/** This class object creates a MeshGenerator for use in the MOOSE framework. The
+    object reads Gmsh UNV (or MSH) files directly into the mesh. */
+class GmshUNVMeshGenerator : public MeshGenerator
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  GmshUNVMeshGenerator(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  std::unique_ptr<MeshBase> generate() override;
+
+protected:
+  /// Function to read the UNV file into the given mesh
+  void readUNV(MeshBase & mesh);
+
+  /// Function to read the nodes dataset (2411)
+  void readNodes(std::istream & in, MeshBase & mesh);
+
+  /// Function to read the elements dataset (2412)
+  void readElements(std::istream & in);
+
+  /// Function to read the groups dataset (2467 or 2477)
+  void readGroups(std::istream & in);
+
+  /// Function to skip the rest of a dataset that is not used
+  void skipDataset(std::istream & in);
+
+  /// Function to add the elements and groups to the mesh after all datasets are read
+  void buildMesh(MeshBase & mesh);
+
+  /// Element record from the UNV file
+  struct UNVElement
+  {
+    int label;                   ///< Label of the element in the file
+    ElemType type;               ///< libMesh element type
+    std::vector<int> nodes;      ///< Node labels in libMesh ordering
+  };
+
+  /// Group record from the UNV file
+  struct UNVGroup
+  {
+    int number;                  ///< Number of the group in the file
+    std::string name;            ///< Name of the group
+    std::vector<int> elements;   ///< Labels of elements in the group
+    std::vector<int> nodes;      ///< Labels of nodes in the group
+  };
+
+  const MeshFileName & _file_name;          ///< Name of the mesh file
+  std::map<int, dof_id_type> _node_ids;     ///< Map from node labels to node ids
+  std::vector<UNVElement> _elements;        ///< Elements read from the file
+  std::vector<UNVGroup> _groups;            ///< Groups read from the file
+};
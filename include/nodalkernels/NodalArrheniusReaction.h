@@ -0,0 +1,66 @@
+/*!
+ *  \file NodalArrheniusReaction.h
+ *    \brief Nodal kernel for a reaction with Arrhenius rate constants
+ *    \details This file creates a nodal kernel for a reaction with rate constants of the Arrhenius
+ * form, i.e., k = A*T^B*exp(-E/R/T). The residual is the same as ArrheniusReaction, but the rate is
+ * evaluated once at each node instead of at each quadrature point.
+ *
+ *            This kernel must be used with other nodal kernels (e.g., TimeDerivativeNodalKernel) on
+ *            the same variable.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalConstReaction.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// NodalArrheniusReaction class object inherits from NodalConstReaction object
+/** This class object gives the rate of ArrheniusReaction evaluated once per node. The
+    temperature must be a nodal (i.e., LAGRANGE) variable. */
+class NodalArrheniusReaction : public NodalConstReaction
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  NodalArrheniusReaction(const InputParameters & parameters);
+
+protected:
+  ///  Function to compute the rate constants
+  virtual void calculateRateConstants() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Function to compute the derivative of the residual with respect to temperature
+  Real computeTemperatureDerivative();
+
+  Real _act_energy_for;         ///< Activation energy forward (J/mol)
+  Real _act_energy_rev;         ///< Activation energy reverse (J/mol)
+  Real _pre_exp_for;            ///< Pre-exponential factor forward (same units as kf)
+  Real _pre_exp_rev;            ///< Pre-exponential factor reverse (same units as kr)
+  Real _beta_for;               ///< Temperature exponential forward (-)
+  Real _beta_rev;               ///< Temperature exponential reverse (-)
+  const VariableValue & _temp;  ///< Coupled temperature variable (K)
+  const unsigned int _temp_var; ///< Variable identification for temperature
+
+private:
+};
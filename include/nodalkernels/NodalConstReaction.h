@@ -0,0 +1,90 @@
+/*!
+ *  \file NodalConstReaction.h
+ *    \brief Nodal kernel for a generic reaction with forward and/or reverse components
+ *    \details This file creates a nodal kernel for a generic reaction with constant rate
+ * coefficients. The residual is the same as ConstReaction, i.e., Res = - a*kf*prod(C_i, v_i) +
+ * a*kr*prod(C_j, v_j), but the rate is evaluated once at each node instead of at each quadrature
+ * point of every element sharing the node.
+ *
+ *            Nodal kernels are not weighted by the element volume, so this kernel must be used with
+ *            other nodal kernels (e.g., TimeDerivativeNodalKernel) on the same variable. This is
+ *            well suited to surface species that only have reactions and a time derivative.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalKernel.h"
+
+/// NodalConstReaction class object inherits from NodalKernel object
+/** This class object inherits from the NodalKernel object in the MOOSE framework.
+    The kernel gives the same reaction rate as ConstReaction, but the rate is evaluated
+    once per node (i.e., nodal quadrature) instead of at every quadrature point. The
+    Jacobian of this kernel is local to each node. */
+class NodalConstReaction : public NodalKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  NodalConstReaction(const InputParameters & parameters);
+
+protected:
+  /// Function to compute the rate constants at the current node
+  /** Constant rates are used by this object, but derived kernels override this function. */
+  virtual void calculateRateConstants();
+
+  /// Required residual function for nodal kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for nodal kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  /// Function to compute the product of the reactants raised to their stoichiometry
+  Real computeReactantProduct();
+
+  /// Function to compute the product of the products raised to their stoichiometry
+  Real computeProductProduct();
+
+  /// Function to compute the derivative of the reactant product with respect to the i-th reactant
+  Real computeReactantProductDerivative(unsigned int i);
+
+  /// Function to compute the derivative of the product product with respect to the i-th product
+  Real computeProductProductDerivative(unsigned int i);
+
+  /// Function to compute the derivative of the residual with respect to the given species
+  Real computeSpeciesDerivative(unsigned int jvar);
+
+  Real _forward_rate;                            ///< Rate constant for forward reaction
+  Real _reverse_rate;                            ///< Rate constant for reverse reaction
+  Real _scale;                                   ///< Scaling parameter for the reaction
+  std::vector<Real> _react_stoich;               ///< Reactant list stoichiometries
+  std::vector<Real> _prod_stoich;                ///< Product list stoichiometries
+  std::vector<const VariableValue *> _reactants; ///< Pointer list to the coupled reactants
+  std::vector<const VariableValue *> _products;  ///< Pointer list to the coupled products
+  std::vector<unsigned int> _react_vars;         ///< Indices for the coupled reactants
+  std::vector<unsigned int> _prod_vars;          ///< Indices for the coupled products
+
+private:
+};
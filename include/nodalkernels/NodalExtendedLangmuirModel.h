@@ -0,0 +1,88 @@
+/*!
+ *  \file NodalExtendedLangmuirModel.h
+ *    \brief Nodal kernel for an extended langmuir function with temperature dependent coefficients
+ *    \details This file creates a nodal kernel for an extended langmuir function, i.e., Res = - b_i
+ * * K_i * coupled_variable_i / (1 + sum(j, K_j * coupled_variable_j)), where the langmuir
+ * coefficients are computed from the van't Hoff expression ln(K_i) = -dH_i/(R*T) + dS_i/R. The
+ * residual is the same as ExtendedLangmuirModel, but the function is evaluated once at each node
+ * instead of at each quadrature point.
+ *
+ *            This should be used with a ReactionNodalKernel on the adsorbed variable to enforce
+ *            that the variable equals this function.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalKernel.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// This macro calculates the natural log of the dimensionless isotherm parameter
+#ifndef lnKo
+#define lnKo(H, S, T) -(H / (Rstd * T)) + (S / Rstd)
+#endif
+
+/// NodalExtendedLangmuirModel class object inherits from NodalKernel object
+/** This class object gives the extended Langmuir function of ExtendedLangmuirModel
+    evaluated once per node. It is used with a nodal reaction or time derivative kernel
+    on the adsorbed variable. */
+class NodalExtendedLangmuirModel : public NodalKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  NodalExtendedLangmuirModel(const InputParameters & parameters);
+
+protected:
+  /// Function to compute all langmuir coefficients from temperature
+  void computeAllLangmuirCoeffs();
+
+  /// Function to compute the sum of the langmuir terms for all coupled concentrations
+  Real computeLangmuirSum();
+
+  /// Required residual function for nodal kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for nodal kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  Real _maxcap;                     ///< Maximum Capacity for the primary adsorbed species (mol/L)
+  std::vector<Real> _langmuir_coef; ///< Langmuir Coefficients for the coupled variables (L/mol)
+  std::vector<Real> _enthalpies;    ///< Vector of enthalpies for all langmuir coefficients (J/mol)
+  std::vector<Real> _entropies; ///< Vector of entropies for all langmuir coefficients (J/K/mol)
+  std::vector<const VariableValue *> _coupled; ///< Pointer list to the coupled gases (mol/L)
+  std::vector<unsigned int>
+      _coupled_vars; ///< Indices for the gas species in the system (sorbed + competetors)
+  const VariableValue & _coupled_i;     ///< Primary Coupled variable (Gas species being sorbed)
+  const unsigned int _coupled_var_i;    ///< Variable identification for the primary variable
+  const VariableValue & _coupled_temp;  ///< Coupled variable for temperature
+  const unsigned int _coupled_var_temp; ///< Index for the coupled temperature variable
+  int _lang_index;                      ///< Index for primary langmuir coefficient
+
+private:
+};
@@ -0,0 +1,55 @@
+/*!
+ *  \file NodalInhibitedArrheniusReaction.h
+ *    \brief Nodal kernel for an inhibited reaction with Arrhenius rate constants
+ *    \details This file creates a nodal kernel for an Arrhenius reaction with inhibition terms,
+ * i.e., kf = A*T^B*exp(-E/R/T)/Rf. The residual is the same as InhibitedArrheniusReaction, but the
+ * rate is evaluated once at each node instead of at each quadrature point.
+ *
+ *            This kernel must be used with other nodal kernels (e.g., TimeDerivativeNodalKernel) on
+ *            the same variable.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalArrheniusReaction.h"
+
+/// NodalInhibitedArrheniusReaction class object inherits from NodalArrheniusReaction object
+/** This class object gives the rate of InhibitedArrheniusReaction evaluated once per node.
+    The inhibition variables must be nodal (i.e., LAGRANGE) variables. */
+class NodalInhibitedArrheniusReaction : public NodalArrheniusReaction
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  NodalInhibitedArrheniusReaction(const InputParameters & parameters);
+
+protected:
+  ///  Function to compute the rate constants
+  virtual void calculateRateConstants() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  const VariableValue & _forward_inhibition; ///< Coupled forward inhibition variable (-)
+  const unsigned int _Rf_var;                ///< Variable identification for Rf
+  const VariableValue & _reverse_inhibition; ///< Coupled reverse inhibition variable (-)
+  const unsigned int _Rr_var;                ///< Variable identification for Rr
+
+private:
+};
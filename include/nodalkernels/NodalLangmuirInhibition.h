@@ -0,0 +1,77 @@
+/*!
+ *  \file NodalLangmuirInhibition.h
+ *    \brief Nodal kernel for creating an inhibition function of a Langmuir form
+ *    \details This file creates a nodal kernel for an inhibition function of a Langmuir form, i.e.,
+ * Res = - (1 + sum(i, K_i * coupled_variable_i)) where K_i = A*T^B*exp(-E/R/T). The residual is the
+ * same as LangmuirInhibition, but the function is evaluated once at each node instead of at each
+ * quadrature point.
+ *
+ *            This should be used with a ReactionNodalKernel on the inhibition variable to enforce
+ *            that the variable equals this function.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This kernel was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "NodalKernel.h"
+
+#ifndef Rstd
+#define Rstd 8.3144621 ///< Gas Constant in J/K/mol (or) L*kPa/K/mol (Standard Units)
+#endif
+
+/// NodalLangmuirInhibition class object inherits from NodalKernel object
+/** This class object gives the inhibition function of LangmuirInhibition evaluated once
+    per node. It is used with a nodal reaction kernel (e.g., ReactionNodalKernel) on the
+    inhibition variable. */
+class NodalLangmuirInhibition : public NodalKernel
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  NodalLangmuirInhibition(const InputParameters & parameters);
+
+protected:
+  /// Function to compute all langmuir coefficients from temperature
+  void computeAllLangmuirCoeffs();
+
+  /// Required residual function for nodal kernels in MOOSE
+  /** This function returns a residual contribution for this object.*/
+  virtual Real computeQpResidual() override;
+
+  /// Required Jacobian function for nodal kernels in MOOSE
+  /** This function returns a Jacobian contribution for this object. The Jacobian being
+   computed is the associated diagonal element in the overall Jacobian matrix for the
+   system and is used in preconditioning of the linear sub-problem. */
+  virtual Real computeQpJacobian() override;
+
+  /// Not Required, but aids in the preconditioning step
+  /** This function returns the off diagonal Jacobian contribution for this object. By
+   returning a non-zero value we will hopefully improve the convergence rate for the
+   cross coupling of the variables. */
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  std::vector<Real>
+      _langmuir_coef; ///< Langmuir Coefficients for the coupled variables (inverse concentration)
+  std::vector<Real> _pre_exp;    ///< Pre-exponential factors for Langmuir coefficients
+  std::vector<Real> _beta;       ///< Beta factors for the Langmuir coefficients
+  std::vector<Real> _act_energy; ///< Activation energies for Langmuir coefficients
+  std::vector<const VariableValue *>
+      _coupled; ///< Pointer list to the coupled gases (concentration units)
+  std::vector<unsigned int> _coupled_vars; ///< Indices for the concentration species in the system
+  const VariableValue & _temp;             ///< Coupled variable for temperature
+  const unsigned int _temp_var;            ///< Index for the coupled temperature variable
+
+private:
+};
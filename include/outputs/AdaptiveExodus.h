@@ -0,0 +1,68 @@
+/*!
+ *  \file AdaptiveExodus.h
+ *    \brief Exodus output that only writes spatial fields on significant changes
+ *    \details This file creates an output object that writes the spatial fields (Exodus) only
+ * when the solution has changed significantly since the last field output, or when a maximum
+ * number of time steps has been skipped. The change is measured per variable as the relative
+ * (max-norm) change of that variable's degrees of freedom since the last output, and the largest
+ * of those changes is compared with the tolerance, so large valued variables (e.g., temperature)
+ * do not hide changes in small ones (e.g., concentrations). The user may restrict the check to a
+ * list of monitored variables. Long transient runs (e.g., TPDs with thousands
+ * of steps) will then write many fewer fields during slow portions of the simulation, while still
+ * resolving the fast transients.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This output was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "Exodus.h"
+
+/// AdaptiveExodus class object inherits from Exodus object
+/** This class object creates an Exodus output that skips time steps where the
+    solution has not changed significantly since the last output. */
+class AdaptiveExodus : public Exodus
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  AdaptiveExodus(const InputParameters & parameters);
+
+  /// Function override to find the monitored variables once the systems exist
+  virtual void initialSetup() override;
+
+  /// Function override to force an output (and new dof lists) after the mesh changes
+  virtual void meshChanged() override;
+
+protected:
+  /// Function override to determine if the output should be written
+  virtual bool shouldOutput() override;
+
+  /// Function to compute the relative change in the solution since the last output
+  Real solutionChange();
+
+  /// Function to store the monitored values of the current solution as the last output
+  void storeSolution();
+
+  Real _tolerance;             ///< Relative change in the solution to trigger an output
+  unsigned int _min_interval;  ///< Minimum number of time steps between outputs
+  unsigned int _max_interval;  ///< Maximum number of time steps between outputs
+  unsigned int _skipped;       ///< Number of time steps since the last output
+
+  std::vector<VariableName> _var_names;        ///< Names of the monitored variables
+  std::vector<unsigned int> _sys_nums;         ///< System number of each monitored variable
+  std::vector<unsigned int> _var_nums;         ///< Variable number of each monitored variable
+  std::vector<std::vector<dof_id_type>> _dofs; ///< Local dof indices of each variable
+  std::vector<std::vector<Number>> _last;      ///< Local values of each at the last output
+};
@@ -0,0 +1,72 @@
+/*!
+ *  \file BinaryPostprocessorOutput.h
+ *    \brief Compact binary time-series output of postprocessors written off the solve thread
+ *    \details This file creates an output object that writes the time and the values of a set of
+ * postprocessors (e.g., outlet concentrations or line averages) to a compact binary file. Each
+ * output only copies the values into a queue, and a separate writer thread writes the queued
+ * rows to the file, so the solver does not wait on file I/O (e.g., on a shared filesystem).
+ *
+ *            The file starts with a text header line (CATS_TIMESERIES, number of columns), then
+ *            one line with the column names (the first column is time), followed by the rows of
+ *            values as 8 byte floating point numbers. The files can be read with the
+ *            MOOSE_Binary_File object in scripts/python/input_output_processing. A recovered
+ *            run appends to the file, and the reader drops the rows that the recovered run
+ *            repeats.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This output was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "FileOutput.h"
+#include <fstream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/// BinaryPostprocessorOutput class object inherits from FileOutput object
+/** This class object creates an output that writes postprocessor values to a
+    binary time-series file with a background writer thread. */
+class BinaryPostprocessorOutput : public FileOutput
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  BinaryPostprocessorOutput(const InputParameters & parameters);
+
+  /// Destructor to finish writing and stop the writer thread
+  virtual ~BinaryPostprocessorOutput();
+
+  /// Function override to return the name of the file
+  virtual std::string filename() override;
+
+protected:
+  /// Function override to queue the current values for writing
+  virtual void output() override;
+
+  /// Function run by the writer thread
+  void writeRows();
+
+  std::vector<PostprocessorName> _pp_names;      ///< Names of the postprocessors to write
+  std::vector<const PostprocessorValue *> _pps;  ///< Values of the postprocessors
+
+  bool _append;                               ///< True to continue the file of a recovered run
+  std::ofstream _file;                        ///< Binary file stream
+  std::deque<std::vector<double>> _queue;     ///< Rows waiting to be written
+  std::mutex _mutex;                          ///< Lock for the queue
+  std::condition_variable _ready;             ///< Signal that rows (or the end) are ready
+  bool _done;                                 ///< True when the writer thread should stop
+  std::thread _writer;                        ///< Writer thread (only on the first processor)
+};
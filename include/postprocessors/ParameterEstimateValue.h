@@ -0,0 +1,52 @@
+/*!
+ *  \file ParameterEstimateValue.h
+ *    \brief Postprocessor to report the results of a LeastSquaresParameterEstimator
+ *    \details This file creates a postprocessor that reports one of the quantities computed
+ *              by a LeastSquaresParameterEstimator user object (i.e., the objective, or the
+ *              gradient, update, or updated value of one of the parameters being fit). Using
+ *              this postprocessor, the next set of parameters for a kinetic fit is written
+ *              directly to the CSV output of the simulation.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This postprocessor was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralPostprocessor.h"
+#include "LeastSquaresParameterEstimator.h"
+
+/// ParameterEstimateValue class object inherits from GeneralPostprocessor object
+/** This class object creates a GeneralPostprocessor for use in the MOOSE framework. The
+    postprocessor reports a value computed by the LeastSquaresParameterEstimator. */
+class ParameterEstimateValue : public GeneralPostprocessor
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  ParameterEstimateValue(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  virtual void initialize() override {}
+
+  /// Required MOOSE function override
+  virtual void execute() override {}
+
+  /// Required MOOSE function override
+  virtual PostprocessorValue getValue() const override;
+
+protected:
+  const LeastSquaresParameterEstimator & _estimator; ///< User object performing the estimation
+  const MooseEnum & _quantity;                       ///< Quantity to report
+  unsigned int _index;                               ///< Index of the parameter to report
+};
@@ -0,0 +1,114 @@
+/*!
+ *  \file LeastSquaresParameterEstimator.h
+ *    \brief User object to fit kinetic parameters to experimental time-series data
+ *    \details This file creates a user object that reads experimental time-series data from a
+ * CSV file (e.g., data processed by the labview_processing scripts), compares those data against
+ * model postprocessor values (e.g., outlet concentrations), and accumulates a weighted
+ * least-squares objective along with its Gauss-Newton gradient and Hessian using the in-solve
+ * parametric sensitivities (see the *Sensitivity kernels). The model values and sensitivities are
+ * linearly interpolated in time to each data point that falls within the last time step, so the
+ * objective does not depend on the time steps of the model. At the end of the simulation a damped
+ * (Levenberg-Marquardt) parameter update is available without re-reading any outputs or
+ * re-running the simulation for each perturbed parameter.
+ *
+ *            Obj = sum(t_d, sum(k, w_k * (y_k(t_d) - d_k(t_d))^2 ))
+ *            grad_p = sum(t_d, sum(k, 2 * w_k * (y_k(t_d) - d_k(t_d)) * dy_k/dp ))
+ *            (J^T*W*J + lambda*diag(J^T*W*J)) * dp = -J^T*W*r
+ *
+ *            y_k = model value (linearly interpolated to the data time t_d), d_k = data value,
+ *            w_k = weight, dy_k/dp = model sensitivity, lambda = damping factor
+ *
+ *            The fit is iterated to convergence in a single run by placing the model in a
+ *            FullSolveMultiApp of a parent app that runs fixed point iterations. The current
+ *            parameter values are given as postprocessors (e.g., Receivers set by a
+ *            MultiAppPostprocessorTransfer), applied to the kernels with Controls, and the
+ *            updated values are transferred back to the parent until they stop changing
+ *            (see test/tests/userobjects/parameter_estimation).
+ *
+ *  \note Data outside of the time range of the simulation do not contribute to the objective.
+ *        If log_parameters = true, then the fit is done on ln(p) so that parameters spanning
+ *        several orders of magnitude (e.g., pre-exponentials) are updated multiplicatively.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This user object was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/// LeastSquaresParameterEstimator class object inherits from GeneralUserObject object
+/** This class object creates a GeneralUserObject for use in the MOOSE framework. The
+    object accumulates a least-squares objective against experimental data and computes
+    a damped Gauss-Newton update for the kinetic parameters. */
+class LeastSquaresParameterEstimator : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  LeastSquaresParameterEstimator(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  virtual void initialize() override;
+
+  /// Required MOOSE function override
+  virtual void execute() override;
+
+  /// Required MOOSE function override
+  virtual void finalize() override;
+
+  /// Function to return the index of the parameter with the given name
+  unsigned int parameterIndex(const std::string & name) const;
+
+  /// Function to return the accumulated objective
+  Real objective() const { return _objective; }
+
+  /// Function to return the current value of the i-th parameter
+  Real parameterValue(unsigned int i) const { return *_param_vals[i]; }
+
+  /// Function to return the gradient of the objective with respect to the i-th parameter
+  Real gradient(unsigned int i) const;
+
+  /// Function to return the update for the i-th parameter
+  Real update(unsigned int i) const { return _update[i]; }
+
+  /// Function to return the updated value of the i-th parameter
+  Real updatedValue(unsigned int i) const;
+
+protected:
+  /// Function to add the residual of one data point to the accumulated system
+  void addDataPoint(unsigned int k, Real model, Real data, std::vector<Real> & J);
+
+  /// Function to solve for the damped Gauss-Newton update from the accumulated system
+  void computeUpdate();
+
+  std::vector<std::string> _param_names;               ///< Names of the parameters being fit
+  std::vector<const PostprocessorValue *> _param_vals; ///< Current values of the parameters
+  std::vector<const PostprocessorValue *> _model_vals; ///< Model values compared to data
+  std::vector<const PostprocessorValue *> _sens_vals;  ///< Model sensitivities (by observable)
+  std::vector<Real> _data_time;                        ///< Times of the data points
+  std::vector<std::vector<Real>> _data;                ///< Values of each data column
+  std::vector<Real> _weights;                          ///< Weights for each observable
+  bool _log_params;                                    ///< True if fitting ln(p)
+  Real _damping;                                       ///< Levenberg-Marquardt damping factor
+  Real _max_step;                                      ///< Maximum relative (or log) step size
+
+  Real & _objective;                ///< Accumulated objective (restartable)
+  std::vector<Real> & _jtr;         ///< Accumulated J^T*W*r (restartable)
+  std::vector<Real> & _jtj;         ///< Accumulated J^T*W*J (restartable, row major)
+  int & _last_step;                 ///< Last time step that was accumulated (restartable)
+  Real & _t_prev;                   ///< Time of the last accumulation (restartable)
+  std::vector<Real> & _model_prev;  ///< Model values at the last accumulation (restartable)
+  std::vector<Real> & _sens_prev;   ///< Sensitivities at the last accumulation (restartable)
+  std::vector<Real> _update;        ///< Update for each parameter
+};
@@ -0,0 +1,76 @@
+/*!
+ *  \file LinearSystemDetector.h
+ *    \brief User object to detect linear systems and solve them with one linear solve
+ *    \details This file creates a user object that checks if the non-linear system of equations is
+ * linear in the unknowns. Kernels that inherit from the LinearityInterface declare their own
+ * linearity (e.g., a first order ConstReaction, or a GPoreConcAdvection with an auxiliary
+ * velocity), and a list of MOOSE types (e.g., TimeDerivative, DirichletBC) are taken to be linear.
+ * If all kernels and boundary conditions are linear, the Newton solve is replaced with one linear
+ * solve per time step (PETSc 'ksponly').
+ *
+ *            If the user also sets 'constant_coefficients = true', the Jacobian and preconditioner
+ *            are lagged so the matrix is assembled and factored only on the first step and when the
+ *            time step size changes. All other steps only assemble the residual and reuse the
+ *            factorization.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This user object was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "LinearityInterface.h"
+
+/// LinearSystemDetector class object inherits from GeneralUserObject object
+/** This class object creates a GeneralUserObject for use in the MOOSE framework. The
+    object checks all kernels and boundary conditions of the non-linear system at the
+    start of the simulation and, if all of them are linear in the unknowns, replaces the
+    Newton solve with a single linear solve per time step. If the user also states that
+    the coefficients are constant in time, the Jacobian (and its factorization) is only
+    assembled when the time step size changes. */
+class LinearSystemDetector : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  LinearSystemDetector(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  virtual void initialize() override;
+
+  /// Required MOOSE function override
+  virtual void execute() override;
+
+  /// Required MOOSE function override
+  virtual void finalize() override;
+
+  /// Function to return true if the system was found to be linear
+  bool isLinear() const { return _linear; }
+
+protected:
+  /// Function to check if the given kernel or boundary condition is linear in the unknowns
+  bool isLinearObject(const MooseObject & object) const;
+
+  /// Function to check all objects of the non-linear system (sets _nonlinear_object if not linear)
+  bool detectLinearity();
+
+  /// Function to set up the solver for the next time step of a linear system
+  void setLinearSolve();
+
+  std::vector<std::string> _linear_types; ///< MOOSE types that are always linear in the unknowns
+  bool _constant_coefs;                   ///< True if the user states the coefficients are constant
+  bool _linear;                           ///< True if the system was found to be linear
+  std::string _nonlinear_object;          ///< Name of the first object found to be non-linear
+  Real _dt_assembled;                     ///< Time step size of the last assembled Jacobian
+};
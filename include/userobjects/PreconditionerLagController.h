@@ -0,0 +1,73 @@
+/*!
+ *  \file PreconditionerLagController.h
+ *    \brief User object to reuse the preconditioner until convergence degrades
+ *    \details This file creates a user object to control the reuse of the preconditioner (and
+ * optionally the Jacobian) in transient simulations. For many CATS problems (e.g., isothermal runs
+ * with ConstantDT) the Jacobian changes little between steps, so the factorization of the
+ * preconditioner (LU or ILU) can be reused over many Newton iterations and time steps.
+ *
+ *            The preconditioner is rebuilt on the first step, after a failed solve, when the number
+ *            of Newton iterations or the average number of linear iterations per Newton iteration
+ *            of the last step exceeded the given limits, at each of the rebuild_times (e.g., the
+ *            input_change_times of the stepwise boundary conditions), and optionally after a fixed
+ *            number of steps. Otherwise the preconditioner from the last rebuild is kept (PETSc lag
+ *            of -1).
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This user object was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+/// PreconditionerLagController class object inherits from GeneralUserObject object
+/** This class object creates a GeneralUserObject for use in the MOOSE framework. The
+    object reuses the preconditioner (and optionally the Jacobian) across Newton iterations
+    and time steps, and forces a rebuild when the linear or nonlinear iteration counts
+    degrade, when a solve fails, or when a boundary condition steps to a new value. */
+class PreconditionerLagController : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  PreconditionerLagController(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  virtual void initialize() override;
+
+  /// Required MOOSE function override
+  virtual void execute() override;
+
+  /// Required MOOSE function override
+  virtual void finalize() override;
+
+protected:
+  /// Function to check if one of the rebuild times is in the current time step
+  bool rebuildTimeInStep() const;
+
+  /// Function to check the iteration counts of the last solve and flag a rebuild if needed
+  void checkLastSolve();
+
+  /// Function to set the lag of the preconditioner (and Jacobian) for the next solve
+  void setLag();
+
+  unsigned int _max_linear_its;      ///< Max average linear iterations per Newton iteration
+  unsigned int _max_nonlinear_its;   ///< Max Newton iterations for a step before a rebuild
+  unsigned int _max_lag_steps;       ///< Max time steps between rebuilds (0 = no limit)
+  bool _lag_jacobian;                ///< True if the Jacobian is also reused
+  std::vector<Real> _rebuild_times;  ///< Times at which a rebuild is forced (e.g., BC steps)
+  bool _rebuild;                     ///< True if the preconditioner is rebuilt on the next solve
+  bool _solve_pending;               ///< True if a solve started but has not finished
+  unsigned int _steps_since_rebuild; ///< Number of time steps since the last rebuild
+};
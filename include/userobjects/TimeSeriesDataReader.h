@@ -0,0 +1,101 @@
+/*!
+ *  \file TimeSeriesDataReader.h
+ *    \brief User object to stream time-series data (e.g., inlet conditions) from a file
+ *    \details This file creates a user object that reads time-series data from a delimited
+ * (comma, tab, or space) file, such as the files produced by the labview_processing scripts, for
+ * use as inlet concentrations, temperatures, or other boundary/auxiliary values. Rather than
+ * loading the full file, the object streams rows from the file as simulation time advances and
+ * keeps only a sliding window of rows in memory. All requested columns are interpolated once per
+ * execution (i.e., once per time step) so that the boundary conditions and auxiliary kernels that
+ * use these values only perform a lookup at each quadrature point or node.
+ *
+ *            Any lines before the header line (i.e., the line that contains the time column
+ *            name) are skipped, so processed data files with a preamble can be used directly.
+ *            Rows without a number in the time column are also skipped, but an invalid or missing
+ *            value in a data row is an error that reports the line of the file. The file is only
+ *            read on the first processor, and the interpolated values are broadcast to the others.
+ *
+ *  \note If time moves backward past the start of the window (e.g., when recovering from a
+ *        checkpoint), then the file is re-opened and streamed forward again.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This user object was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include <fstream>
+#include <deque>
+
+/// TimeSeriesDataReader class object inherits from GeneralUserObject object
+/** This class object creates a GeneralUserObject for use in the MOOSE framework. The
+    object streams time-series data from a file and interpolates the data in time. */
+class TimeSeriesDataReader : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  TimeSeriesDataReader(const InputParameters & parameters);
+
+  /// Required MOOSE function override
+  virtual void initialize() override;
+
+  /// Required MOOSE function override
+  virtual void execute() override;
+
+  /// Required MOOSE function override
+  virtual void finalize() override;
+
+  /// Function to return the index of the given column name
+  unsigned int columnIndex(const std::string & name) const;
+
+  /// Function to return the current (interpolated) value of the i-th column
+  Real value(unsigned int i) const { return _current[i]; }
+
+protected:
+  /// Function to open the file and read up to (and including) the header line
+  void openFile();
+
+  /// Function to read the next row of data into the window (returns false at end of file)
+  bool readRow();
+
+  /// Function to report an invalid entry on the current line of the file (with the line number)
+  void invalidEntry(const std::string & entry, const std::string & column) const;
+
+  /// Function to move the window forward (or back) so that it brackets the given time
+  void advanceTo(Real time);
+
+  /// Function to update the current values on all processors (the file is read on the first)
+  void updateValues(Real time);
+
+  /// Function to split a line of the file into its entries
+  std::vector<std::string> splitLine(const std::string & line) const;
+
+  FileName _file_name;                  ///< Name of the file with the data
+  std::string _time_column;             ///< Name of the time column
+  std::vector<std::string> _columns;    ///< Names of the data columns to read
+  unsigned int _window;                 ///< Number of rows to keep in memory
+  Real _time_scale;                     ///< Factor to convert file time to simulation time
+  Real _time_offset;                    ///< Offset added to file time (after scaling)
+  bool _step;                           ///< True for step (zero-order hold) interpolation
+
+  std::ifstream _file;                  ///< File stream for the data
+  bool _end_of_file;                    ///< True if all rows have been read
+  unsigned int _line;                   ///< Number of the last line read from the file
+  unsigned int _time_index;             ///< Location of the time column in each row
+  std::vector<unsigned int> _indices;   ///< Locations of the data columns in each row
+  std::deque<Real> _times;              ///< Window of times
+  std::vector<std::deque<Real>> _vals;  ///< Window of values for each column
+  std::vector<Real> _current;           ///< Current interpolated values for each column
+};
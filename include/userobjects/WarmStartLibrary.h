@@ -0,0 +1,103 @@
+/*!
+ *  \file WarmStartLibrary.h
+ *    \brief User object to save and reload pre-equilibrated states from a warm-start library
+ *    \details This file creates a user object that saves the full solution state (all nonlinear
+ * and auxiliary variables) at the end of each stage of a preconditioning protocol (e.g., the
+ * adsorption/saturation phase before a TPD) into a library of snapshots. Each snapshot is keyed by
+ * a hash of the protocol name, the mesh size, the variables and number of dofs, the input file
+ * (optional), and all of the parameters of the stages up to (and including) that stage. When a
+ * later run with the same protocol and upstream parameters starts (Executioner/start_time) at the
+ * end of a stage, the matching snapshot is loaded as the initial state, so the repeated
+ * pre-equilibration phase is skipped. Only the parameters that affect the preconditioning should be
+ * given to this object, and key_on_input_file = false allows changes to downstream parameters
+ * (e.g., the kinetics of the TPD ramp) in the input file to still re-use the stored states.
+ *
+ *            Snapshots are written in a partition independent format (keyed by node and element
+ *            ids, with each dof stored once), so they can be re-used with a different number of
+ *            processors, but the mesh and the variables must be the same as when the snapshot was
+ *            made.
+ *
+ *  \note Stateful material properties are not stored in the snapshot. A stage is saved on the
+ *        first time step that reaches its stage time, so time steps should land on the stage
+ *        times for the snapshot to be the exact state at the end of the stage. Nothing is loaded
+ *        when the simulation is recovered or restarted.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright This user object was designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "libmesh/dof_object.h"
+
+/// WarmStartLibrary class object inherits from GeneralUserObject object
+/** This class object creates a GeneralUserObject for use in the MOOSE framework. The
+    object saves and reloads snapshots of the solution state keyed by the preconditioning
+    protocol and its parameters. */
+class WarmStartLibrary : public GeneralUserObject
+{
+public:
+  /// Required new syntax for InputParameters
+  static InputParameters validParams();
+
+  /// Required constructor for objects in MOOSE
+  WarmStartLibrary(const InputParameters & parameters);
+
+  /// Function to build the hash keys for each stage (after the dofs are distributed)
+  virtual void initialSetup() override;
+
+  /// Required MOOSE function override
+  virtual void initialize() override;
+
+  /// Required MOOSE function override
+  virtual void execute() override;
+
+  /// Required MOOSE function override
+  virtual void finalize() override;
+
+  /// Function to return the index of the stage that was loaded (-1 if none were loaded)
+  int loadedStage() const { return _loaded_stage; }
+
+protected:
+  /// Function to return the file name of the snapshot for the given stage
+  std::string stageFile(unsigned int stage) const;
+
+  /// Function to check if a file exists
+  bool fileExists(const std::string & file) const;
+
+  /// Function to return the FNV-1a hash of a string
+  uint64_t hashString(const std::string & str) const;
+
+  /// Function to append the values of all dofs of the given node or element to the data
+  void packDofs(const DofObject & obj,
+                unsigned int type,
+                const std::vector<std::pair<unsigned int, unsigned int>> & vars,
+                std::vector<Real> & data);
+
+  /// Function to write the current solution state to the given file
+  void saveState(const std::string & file);
+
+  /// Function to read the solution state from the given file
+  void loadState(const std::string & file);
+
+  std::string _directory;            ///< Directory of the warm-start library
+  std::string _protocol;             ///< Name of the preconditioning protocol
+  std::vector<Real> _stage_times;    ///< Times at the end of each stage of the protocol
+  std::vector<std::string> _keys;    ///< Hash keys for each stage
+  bool _load;                        ///< True if states are loaded from the library
+  bool _save;                        ///< True if states are saved to the library
+  bool _key_on_input;                ///< True if the input file is part of the hash keys
+  std::vector<Real> _params;         ///< Values of the parameters of all stages
+  std::vector<unsigned int> _counts; ///< Number of parameters in each stage
+  std::vector<bool> _saved;          ///< Flags for the stages that are already in the library
+  int _loaded_stage;                 ///< Index of the stage that was loaded
+};
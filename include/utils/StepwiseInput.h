@@ -0,0 +1,50 @@
+/*!
+ *  \file StepwiseInput.h
+ *    \brief Helper functions for stepwise inputs in time
+ *    \details This file creates helper functions shared by the boundary conditions and auxiliary
+ * kernels with stepwise inputs in time. The input changes from a start value to each of a list of
+ * input values at the corresponding input times. Optionally, a time span can be given for each
+ * input so that the value is ramped linearly over that span (centered on the input time) instead of
+ * changing abruptly. One function checks the inputs and computes the slopes of the ramps (called
+ * once from the constructors), and the other computes the input value at a given time.
+ *
+ *            The value is computed from the current time alone (no stored index or previous value),
+ *            so the inputs are the same after a restart, a recover, or a failed time step.
+ *
+ *  \author Austin Ladshaw
+ *  \date 10/18/2026
+ *  \copyright These functions were designed and built at Oak Ridge National
+ *              Laboratory by Austin Ladshaw for research in catalyst
+ *              performance for new vehicle technologies.
+ *
+ *               Austin Ladshaw does not claim any ownership or copyright to the
+ *               MOOSE framework in which these kernels are constructed, only
+ *               the kernels themselves. The MOOSE framework copyright is held
+ *               by the Battelle Energy Alliance, LLC (c) 2010, all rights reserved.
+ */
+
+#pragma once
+
+#include "MooseTypes.h"
+
+/// Function to check and complete the stepwise inputs and to compute the slopes of the ramps
+/** The input values and times must have the same size. Missing time spans are set to zero (an
+    abrupt change), and if no inputs are given the start value is used as the only input (at
+    time zero). The slope of each ramp is returned in slopes. */
+void setupStepwiseInput(Real start_value,
+                        std::vector<Real> & input_vals,
+                        std::vector<Real> & input_times,
+                        std::vector<Real> & time_spans,
+                        std::vector<Real> & slopes);
+
+/// Function to compute a stepwise input value at the given time
+/** The value is the start value before the first input time, the input value of the last input
+    time passed, or a linear ramp between the previous and next input values while inside the
+    time span of an input. The slopes of the ramps are given for each input (slope i is the
+    change from input i-1, or the start value, to input i divided by time span i). */
+Real stepwiseInputValue(Real time,
+                        Real start_value,
+                        const std::vector<Real> & input_vals,
+                        const std::vector<Real> & input_times,
+                        const std::vector<Real> & time_spans,
+                        const std::vector<Real> & slopes);
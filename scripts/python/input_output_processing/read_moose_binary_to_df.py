@@ -0,0 +1,66 @@
+'''
+    This script will read the binary time-series files produced by the
+    BinaryPostprocessorOutput object in CATS into a Pandas dataframe. The
+    resulting object behaves the same as the MOOSE_CVS_File object, so the
+    same post-processing (e.g., value interpolation) can be used for either
+    type of output file.
+
+    A recovered simulation appends to the binary file of the failed run, so
+    rows written after the last checkpoint appear twice. Only the rows of the
+    recovered run are kept for those times.
+
+    Usage:      python read_moose_binary_to_df.py file_out.bin
+
+    Author:     Austin Ladshaw
+    Date:       10/18/2026
+    Copyright:  This kernel was designed and built at Oak Ridge National
+                Laboratory by Austin Ladshaw for research in the area
+                of adsorption, catalysis, and surface science.
+'''
+# import statements
+import numpy
+from read_moose_csv_to_df import *
+
+# Read the binary file into a dataframe
+def read_binary_timeseries(file):
+    if not path.exists(file):
+        raise FileNotFoundError(errno.ENOENT, os.strerror(errno.ENOENT), file)
+    with open(file, 'rb') as f:
+        header = f.readline().decode().split()
+        if len(header) != 2 or header[0] != "CATS_TIMESERIES":
+            raise IndexError("File (" + file + ") is not a CATS binary time-series file.")
+        names = f.readline().decode().split()
+        data = numpy.frombuffer(f.read(), dtype=numpy.float64)
+    ncols = int(header[1])
+    nrows = len(data)//ncols
+    data = data[0:nrows*ncols].reshape(nrows, ncols)
+
+    # Drop rows that a recovered run wrote again (time restarts at the checkpoint)
+    keep = []
+    for i in range(nrows):
+        while len(keep) > 0 and data[keep[-1], 0] >= data[i, 0]:
+            keep.pop()
+        keep.append(i)
+    return pandas.DataFrame(data[keep], columns=names)
+
+# Object to handle the data associated with CATS generated binary files
+class MOOSE_Binary_File(MOOSE_CVS_File):
+    # Default constructor
+    def __init__(self, file):
+        self.read_new_file(file)
+
+    # Read a new file into same object (override the previous)
+    def read_new_file(self, file):
+        self.df = read_binary_timeseries(file)
+        self.valid_col_names = []
+        for c in self.df:
+            self.valid_col_names.append(c)
+        self.num_rows = len(self.df['time'])
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage: python read_moose_binary_to_df.py file_out.bin")
+        sys.exit(1)
+    obj = MOOSE_Binary_File(sys.argv[1])
+    print(obj.df)
@@ -0,0 +1,108 @@
+# Solids fractions computed from a constant porosity and from a porosity that changes in
+#   time. The first is only computed once, the second must follow the porosity at every step.
+#
+#   pore = 0.5 + 0.1*t   ==>   non_pore = 0.5 - 0.1*t
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./pore]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+  [./non_pore]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+  [./non_pore_const]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./pore_func]
+    type = ParsedFunction
+    value = 0.5+0.1*t
+  [../]
+[]
+
+[Kernels]
+  [./u_dot]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./pore_calc]
+    type = FunctionAux
+    variable = pore
+    function = pore_func
+    execute_on = 'initial timestep_end'
+  [../]
+  [./non_pore_calc]
+    type = SolidsVolumeFraction
+    variable = non_pore
+    porosity = pore
+    execute_on = 'initial timestep_end'
+  [../]
+  [./non_pore_const_calc]
+    type = SolidsVolumeFraction
+    variable = non_pore_const
+    porosity = 0.3
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Postprocessors]
+  [./non_pore]
+    type = ElementAverageValue
+    variable = non_pore
+    execute_on = 'initial timestep_end'
+  [../]
+  [./non_pore_const]
+    type = ElementAverageValue
+    variable = non_pore_const
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  l_tol = 1e-12
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
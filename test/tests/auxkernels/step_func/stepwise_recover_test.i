@@ -0,0 +1,109 @@
+# Stepwise input with linear ramps, checked for restart and recover
+#
+#   The input goes from 0 to 1 at t = 0.5, ramps from 1 to 3 between t = 0.75
+#   and t = 1.25, and ramps from 3 to 2 between t = 1.5 and t = 1.75. The
+#   first ramp spans the middle of the simulation (t = 1), where the recover
+#   test stops and restarts, so the recovered run must give the same inputs
+#   as the full run. The variable follows the input as du/dt = u_in - u.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./u_in]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./u_dot]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./u_rxn]
+    type = Reaction
+    variable = u
+  [../]
+  [./u_input]
+    type = CoupledForce
+    variable = u
+    v = u_in
+  [../]
+[]
+
+[AuxKernels]
+  [./step_input]
+    type = TemporalStepFunction
+    variable = u_in
+    start_value = 0
+    aux_vals = '1 3 2'
+    aux_times = '0.5 1.0 1.625'
+    time_spans = '0 0.5 0.25'
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Postprocessors]
+  [./u]
+    type = ElementAverageValue
+    variable = u
+    execute_on = 'initial timestep_end'
+  [../]
+  [./u_in]
+    type = ElementAverageValue
+    variable = u_in
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,132 @@
+# Inlet conditions streamed from a tab-delimited (processed) data file
+#
+#   The data file has a preamble before the column names and the time is
+#   given in minutes (time_scale = 60 converts to seconds). The temperature
+#   is interpolated linearly and the inlet ppm is held constant between rows
+#   (step interpolation). A window of only 2 rows is kept in memory.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./T_in]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+  [./y_in]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+[]
+
+[AuxKernels]
+  [./T_in_data]
+    type = AuxTimeSeriesValue
+    variable = T_in
+    data_reader = inlet_temperature
+    column = 'T_in (K)'
+    execute_on = 'initial timestep_begin'
+  [../]
+  [./y_in_data]
+    type = AuxTimeSeriesValue
+    variable = y_in
+    data_reader = inlet_ppm
+    column = 'y_in (ppm)'
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[BCs]
+
+[]
+
+[UserObjects]
+  [./inlet_temperature]
+    type = TimeSeriesDataReader
+    file = 'inlet_data.txt'
+    time_column = 'Time (min)'
+    columns = 'T_in (K)'
+    time_scale = 60
+    window_size = 2
+    interpolation = linear
+  [../]
+  [./inlet_ppm]
+    type = TimeSeriesDataReader
+    file = 'inlet_data.txt'
+    time_column = 'Time (min)'
+    columns = 'y_in (ppm)'
+    time_scale = 60
+    window_size = 2
+    interpolation = step
+  [../]
+[]
+
+[Postprocessors]
+    [./T_in]
+        type = ElementAverageValue
+        variable = T_in
+        execute_on = 'initial timestep_end'
+    [../]
+    [./y_in]
+        type = ElementAverageValue
+        variable = y_in
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = pjfnk
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -ksp_gmres_restart -pc_type -sub_pc_type'
+  petsc_options_value = 'gmres 300 asm lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-8
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 210.0
+  dtmax = 15.0
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 15.0
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,126 @@
+# Fast inhibited reaction where the first Newton step would give a
+#   negative concentration without the damper:
+#
+#     dA/dt = -k*A/R
+#         R =  1 + A
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./R]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 2
+  [../]
+[]
+
+[AuxVariables]
+  [./temp]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 300
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxn]
+    type = InhibitedArrheniusReaction
+    variable = A
+    this_variable = A
+    forward_pre_exponential = 40.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    forward_inhibition = R
+    temperature = temp
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+  [./R_eq]
+    type = Reaction
+    variable = R
+  [../]
+  [./R_lang]
+    type = LangmuirInhibition
+    variable = R
+    temperature = temp
+    coupled_list = 'A'
+    pre_exponentials = '1'
+  [../]
+[]
+
+[Dampers]
+  [./A_bounds]
+    type = PhysicalBoundsDamper
+    variable = A
+    variable_type = concentration
+    fraction_to_boundary = 0.9
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./R]
+    type = ElementAverageValue
+    variable = R
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 30
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,166 @@
+# Adiabatic temperature rise from an exothermic reaction followed by an endothermic one
+#   r1:  A -> B   (ArrheniusReactionRate, k = 2*exp(-5000/R/T), dH = -200 J/mol)
+#   r2:  B -> *   (ConstReactionRate, k = 1, dH = 50 J/mol)
+#
+#   dA/dt = -r1,  dB/dt = r1 - r2,  dT/dt = -fv*av*(dH1*r1 + dH2*r2)
+#
+# The volume fraction (fv = 0.5) and specific area (av = 2) are aux variables, and
+#   the Arrhenius rate feeds the temperature back into both balances.
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 400
+  [../]
+[]
+
+[AuxVariables]
+  [./eps]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.5
+  [../]
+  [./av]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 2
+  [../]
+[]
+
+[Materials]
+  [./r1]
+    type = ArrheniusReactionRate
+    rate_name = r1
+    forward_pre_exponential = 2
+    forward_beta = 0
+    forward_activation_energy = 5000
+    reverse_pre_exponential = 0
+    temperature = T
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./r2]
+    type = ConstReactionRate
+    rate_name = r2
+    forward_rate = 1
+    reverse_rate = 0
+    reactants = 'B'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxns]
+    type = ReactionRateSum
+    variable = A
+    rate_names = 'r1'
+    weights = '-1'
+    coupled_variables = 'T'
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxns]
+    type = ReactionRateSum
+    variable = B
+    rate_names = 'r1 r2'
+    weights = '1 -1'
+    coupled_variables = 'A T'
+  [../]
+  [./T_dot]
+    type = TimeDerivative
+    variable = T
+  [../]
+  [./T_rxns]
+    type = ReactionHeatSource
+    variable = T
+    rate_names = 'r1 r2'
+    enthalpies = '-200 50'
+    volume_frac = eps
+    specific_area = av
+    coupled_variables = 'A B'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./T]
+    type = ElementAverageValue
+    variable = T
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
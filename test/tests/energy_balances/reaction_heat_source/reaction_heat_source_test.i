@@ -0,0 +1,119 @@
+# Heat of a first order reaction (A -> products, r = A) added to an energy balance
+#   from the rate material (dH = -2 J/mol, so dE/dt = 2*A)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./E]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./eps]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[Materials]
+  [./r1]
+    type = ConstReactionRate
+    rate_name = r1
+    forward_rate = 1
+    reverse_rate = 0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxns]
+    type = ReactionRateSum
+    variable = A
+    rate_names = 'r1'
+    weights = '-1'
+  [../]
+  [./E_dot]
+    type = TimeDerivative
+    variable = E
+  [../]
+  [./E_rxns]
+    type = ReactionHeatSource
+    variable = E
+    rate_names = 'r1'
+    enthalpies = '-2'
+    volume_frac = eps
+    coupled_variables = 'A'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./E]
+    type = ElementAverageValue
+    variable = E
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
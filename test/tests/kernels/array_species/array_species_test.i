@@ -0,0 +1,158 @@
+# Two species stored in a single array variable with a film mass transfer
+#   from a constant bulk phase:
+#
+#     eps * dC_i/dt = Ga * km_i * (Cb_i - C_i)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./C]
+    order = FIRST
+    family = MONOMIAL
+    components = 2
+    initial_condition = '0 0'
+  [../]
+[]
+
+[AuxVariables]
+  [./Cb]
+    order = FIRST
+    family = MONOMIAL
+    components = 2
+    initial_condition = '1 2'
+  [../]
+  [./km]
+    order = FIRST
+    family = MONOMIAL
+    components = 2
+    initial_condition = '1 2'
+  [../]
+  [./D]
+    order = FIRST
+    family = MONOMIAL
+    components = 2
+    initial_condition = '0.1 0.2'
+  [../]
+  [./eps]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0.5
+  [../]
+  [./vel]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./C_0]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+  [./C_1]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./C_dot]
+    type = ArrayVariableCoefTimeDerivative
+    variable = C
+    coupled_coef = eps
+  [../]
+  [./C_gadv]
+    type = ArrayGPoreConcAdvection
+    variable = C
+    porosity = eps
+    ux = vel
+    uy = vel
+    uz = vel
+  [../]
+  [./C_gdiff]
+    type = ArrayGVarPoreDiffusion
+    variable = C
+    porosity = eps
+    Dx = D
+    Dy = D
+    Dz = D
+  [../]
+  [./C_trans]
+    type = ArrayFilmMassTransfer
+    variable = C
+    coupled = Cb
+    rate_variable = km
+    av_ratio = 2
+  [../]
+[]
+
+[AuxKernels]
+  [./C_0]
+    type = ArrayVariableComponent
+    variable = C_0
+    array_variable = C
+    component = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C_1]
+    type = ArrayVariableComponent
+    variable = C_1
+    array_variable = C
+    component = 1
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Postprocessors]
+  [./C_0]
+    type = ElementAverageValue
+    variable = C_0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C_1]
+    type = ElementAverageValue
+    variable = C_1
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
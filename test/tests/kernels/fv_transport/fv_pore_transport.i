@@ -0,0 +1,115 @@
+# Steady 1D finite volume advection, diffusion, film mass transfer, and
+#   reaction of a species in the pore space of a column with a ppm inlet
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+  xmin = 0.0
+  xmax = 1.0
+[]
+
+[Variables]
+  [./C]
+    type = MooseVariableFVReal
+  [../]
+[]
+
+[AuxVariables]
+  [./vel]
+    type = MooseVariableFVReal
+    initial_condition = 1.0
+  [../]
+  [./eps]
+    type = MooseVariableFVReal
+    initial_condition = 0.5
+  [../]
+[]
+
+[FVKernels]
+  [./C_adv]
+    type = FVPoreConcAdvection
+    variable = C
+    porosity = eps
+    ux = vel
+  [../]
+  [./C_diff]
+    type = FVVarPoreDiffusion
+    variable = C
+    porosity = eps
+    Dx = 0.1
+    Dy = 0.1
+    Dz = 0.1
+  [../]
+  [./C_trans]
+    type = FVFilmMassTransfer
+    variable = C
+    coupled = 0.0001
+    rate_variable = 1.0
+    av_ratio = 2.0
+  [../]
+  [./C_rxn]
+    type = FVArrheniusReaction
+    variable = C
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 1000.0
+    temperature = 300.0
+    scale = -1.0
+    reactants = 'C'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[FVBCs]
+  [./C_in]
+    type = FVPoreConcFluxBC_ppm
+    variable = C
+    boundary = 'left'
+    porosity = eps
+    ux = vel
+    temperature = 300.0
+    inlet_ppm = 10000.0
+  [../]
+  [./C_out]
+    type = FVPoreConcFluxBC
+    variable = C
+    boundary = 'right'
+    porosity = eps
+    ux = vel
+  [../]
+[]
+
+[Postprocessors]
+  [./C_first]
+    type = ElementalVariableValue
+    variable = C
+    elementid = 0
+    execute_on = 'timestep_end'
+  [../]
+  [./C_last]
+    type = ElementalVariableValue
+    variable = C
+    elementid = 3
+    execute_on = 'timestep_end'
+  [../]
+  [./C_avg]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = newton
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
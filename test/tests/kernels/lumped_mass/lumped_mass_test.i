@@ -0,0 +1,114 @@
+# Pore species adsorbing onto a surface with lumped (nodal) time derivatives:
+#
+#     eps * dC/dt + dq/dt = 0
+#               dq/dt = k * C
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./C]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./q]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./eps]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.5
+  [../]
+[]
+
+[Kernels]
+  [./C_dot]
+    type = VariableCoefTimeDerivative
+    variable = C
+    coupled_coef = eps
+    lumped_mass = true
+  [../]
+  [./q_trans]
+    type = CoupledCoeffTimeDerivative
+    variable = C
+    coupled = q
+    lumped_mass = true
+  [../]
+  [./q_dot]
+    type = TimeDerivative
+    variable = q
+  [../]
+  [./q_rxn]
+    type = ConstReaction
+    variable = q
+    this_variable = q
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = 1.0
+    reactants = 'C'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[Postprocessors]
+  [./C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'initial timestep_end'
+  [../]
+  [./q]
+    type = ElementAverageValue
+    variable = q
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
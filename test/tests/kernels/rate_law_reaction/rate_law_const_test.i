@@ -0,0 +1,160 @@
+# Reversible reaction (2A <-> B) solved with ConstReaction (A, B) and with the policy
+#   composed RateLawConstReaction (A_rl, B_rl); both pairs must give identical results
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./A_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxn]
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = -2.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxn]
+    type = ConstReaction
+    variable = B
+    this_variable = B
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./A_rl_dot]
+    type = TimeDerivative
+    variable = A_rl
+  [../]
+  [./A_rl_rxn]
+    type = RateLawConstReaction
+    variable = A_rl
+    this_variable = A_rl
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = -2.0
+    reactants = 'A_rl'
+    reactant_stoich = '2'
+    products = 'B_rl'
+    product_stoich = '1'
+  [../]
+  [./B_rl_dot]
+    type = TimeDerivative
+    variable = B_rl
+  [../]
+  [./B_rl_rxn]
+    type = RateLawConstReaction
+    variable = B_rl
+    this_variable = B_rl
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = 1.0
+    reactants = 'A_rl'
+    reactant_stoich = '2'
+    products = 'B_rl'
+    product_stoich = '1'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A_rl]
+    type = ElementAverageValue
+    variable = A_rl
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B_rl]
+    type = ElementAverageValue
+    variable = B_rl
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,156 @@
+# Equilibrium (A <-> B, B = K(T) A) with nonlinear temperature (T = 300 + 40 t) and a first
+#   order decay of A, solved with EquilibriumReaction and with RateLawEquilibriumReaction
+#   (the *_rl variables); both sets must give identical results
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 300
+  [../]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./A_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./T_dot]
+    type = TimeDerivative
+    variable = T
+  [../]
+  [./T_ramp]
+    type = BodyForce
+    variable = T
+    value = 40.0
+  [../]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_decay]
+    type = Reaction
+    variable = A
+  [../]
+  [./B_eq]
+    type = EquilibriumReaction
+    variable = B
+    this_variable = B
+    temperature = T
+    enthalpy = -10000.0
+    entropy = -20.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./A_rl_dot]
+    type = TimeDerivative
+    variable = A_rl
+  [../]
+  [./A_rl_decay]
+    type = Reaction
+    variable = A_rl
+  [../]
+  [./B_rl_eq]
+    type = RateLawEquilibriumReaction
+    variable = B_rl
+    this_variable = B_rl
+    temperature = T
+    enthalpy = -10000.0
+    entropy = -20.0
+    reactants = 'A_rl'
+    reactant_stoich = '1'
+    products = 'B_rl'
+    product_stoich = '1'
+  [../]
+[]
+
+[Postprocessors]
+  [./T]
+    type = ElementAverageValue
+    variable = T
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A_rl]
+    type = ElementAverageValue
+    variable = A_rl
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B_rl]
+    type = ElementAverageValue
+    variable = B_rl
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
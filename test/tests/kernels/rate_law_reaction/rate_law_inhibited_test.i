@@ -0,0 +1,287 @@
+# Reversible reaction (A <-> B) with nonlinear temperature (T = 400 + 40 t) and Langmuir
+#   inhibition of both directions (R = 1 + K_A A, Q = 1 + K_B B), solved with
+#   InhibitedArrheniusReaction and with RateLawInhibitedArrheniusReaction (the *_rl variables);
+#   both sets must give identical results
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 400
+  [../]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./R]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./Q]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./A_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./R_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./Q_rl]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[Kernels]
+  [./T_dot]
+    type = TimeDerivative
+    variable = T
+  [../]
+  [./T_ramp]
+    type = BodyForce
+    variable = T
+    value = 40.0
+  [../]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxn]
+    type = InhibitedArrheniusReaction
+    variable = A
+    this_variable = A
+    temperature = T
+    forward_inhibition = R
+    reverse_inhibition = Q
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 20.0
+    reverse_activation_energy = 8000.0
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxn]
+    type = InhibitedArrheniusReaction
+    variable = B
+    this_variable = B
+    temperature = T
+    forward_inhibition = R
+    reverse_inhibition = Q
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 20.0
+    reverse_activation_energy = 8000.0
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./R_eq]
+    type = Reaction
+    variable = R
+  [../]
+  [./R_lang]
+    type = LangmuirInhibition
+    variable = R
+    temperature = T
+    coupled_list = 'A'
+    pre_exponentials = '0.5'
+    activation_energies = '-2000.0'
+  [../]
+  [./Q_eq]
+    type = Reaction
+    variable = Q
+  [../]
+  [./Q_lang]
+    type = LangmuirInhibition
+    variable = Q
+    temperature = T
+    coupled_list = 'B'
+    pre_exponentials = '0.2'
+  [../]
+  [./A_rl_dot]
+    type = TimeDerivative
+    variable = A_rl
+  [../]
+  [./A_rl_rxn]
+    type = RateLawInhibitedArrheniusReaction
+    variable = A_rl
+    this_variable = A_rl
+    temperature = T
+    forward_inhibition = R_rl
+    reverse_inhibition = Q_rl
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 20.0
+    reverse_activation_energy = 8000.0
+    scale = -1.0
+    reactants = 'A_rl'
+    reactant_stoich = '1'
+    products = 'B_rl'
+    product_stoich = '1'
+  [../]
+  [./B_rl_dot]
+    type = TimeDerivative
+    variable = B_rl
+  [../]
+  [./B_rl_rxn]
+    type = RateLawInhibitedArrheniusReaction
+    variable = B_rl
+    this_variable = B_rl
+    temperature = T
+    forward_inhibition = R_rl
+    reverse_inhibition = Q_rl
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 20.0
+    reverse_activation_energy = 8000.0
+    scale = 1.0
+    reactants = 'A_rl'
+    reactant_stoich = '1'
+    products = 'B_rl'
+    product_stoich = '1'
+  [../]
+  [./R_rl_eq]
+    type = Reaction
+    variable = R_rl
+  [../]
+  [./R_rl_lang]
+    type = LangmuirInhibition
+    variable = R_rl
+    temperature = T
+    coupled_list = 'A_rl'
+    pre_exponentials = '0.5'
+    activation_energies = '-2000.0'
+  [../]
+  [./Q_rl_eq]
+    type = Reaction
+    variable = Q_rl
+  [../]
+  [./Q_rl_lang]
+    type = LangmuirInhibition
+    variable = Q_rl
+    temperature = T
+    coupled_list = 'B_rl'
+    pre_exponentials = '0.2'
+  [../]
+[]
+
+[Postprocessors]
+  [./T]
+    type = ElementAverageValue
+    variable = T
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./R]
+    type = ElementAverageValue
+    variable = R
+    execute_on = 'initial timestep_end'
+  [../]
+  [./Q]
+    type = ElementAverageValue
+    variable = Q
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A_rl]
+    type = ElementAverageValue
+    variable = A_rl
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B_rl]
+    type = ElementAverageValue
+    variable = B_rl
+    execute_on = 'initial timestep_end'
+  [../]
+  [./R_rl]
+    type = ElementAverageValue
+    variable = R_rl
+    execute_on = 'initial timestep_end'
+  [../]
+  [./Q_rl]
+    type = ElementAverageValue
+    variable = Q_rl
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,255 @@
+# Forward sensitivity of A --> B with respect to the forward pre-exponential factor
+#
+#   The sensitivity variables (sA = dA/dAf, sB = dB/dAf, sR = dR/dAf) are solved
+#   simultaneously with the species. The time derivative kernels are linear, so
+#   the same kernels act on the sensitivity variables. Only the nonlinear reaction
+#   and inhibition kernels need their sensitivity counterparts.
+#
+#   Analytical:  A = exp(-kf*t)    dA/dAf = -t*exp(-Ef/R/T)*exp(-kf*t)
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+#Inhibition variable
+  [./R]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 2
+  [../]
+
+#Sensitivity variables
+  [./sA]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sB]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sR]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./temp]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 400  #K
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_loss]  #   A --> B
+    type = ArrheniusReaction
+    variable = A
+    this_variable = A
+    temperature = temp
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_gain]  #   A --> B
+    type = ArrheniusReaction
+    variable = B
+    this_variable = B
+    temperature = temp
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./R_eq]
+    type = Reaction
+    variable = R
+  [../]
+  [./R_lang]
+    type = LangmuirInhibition
+    variable = R
+    temperature = temp
+    coupled_list = 'A'
+    pre_exponentials = '1'
+  [../]
+
+#Sensitivity equations
+  [./sA_dot]
+    type = TimeDerivative
+    variable = sA
+  [../]
+  [./sA_loss]
+    type = ArrheniusReactionSensitivity
+    variable = sA
+    this_variable = A
+    temperature = temp
+    sensitivity_parameter = forward_pre_exponential
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sB_dot]
+    type = TimeDerivative
+    variable = sB
+  [../]
+  [./sB_gain]
+    type = ArrheniusReactionSensitivity
+    variable = sB
+    this_variable = B
+    temperature = temp
+    sensitivity_parameter = forward_pre_exponential
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sR_eq]
+    type = Reaction
+    variable = sR
+  [../]
+  [./sR_lang]
+    type = LangmuirInhibitionSensitivity
+    variable = sR
+    temperature = temp
+    coupled_list = 'A'
+    coupled_sensitivities = 'sA'
+    pre_exponentials = '1'
+    sensitivity_parameter = none
+  [../]
+[]
+
+[BCs]
+
+[]
+
+[Postprocessors]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./B]
+       type = ElementAverageValue
+       variable = B
+       execute_on = 'initial timestep_end'
+    [../]
+    [./R]
+        type = ElementAverageValue
+        variable = R
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sA]
+        type = ElementAverageValue
+        variable = sA
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sB]
+       type = ElementAverageValue
+       variable = sB
+       execute_on = 'initial timestep_end'
+    [../]
+    [./sR]
+        type = ElementAverageValue
+        variable = sR
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = pjfnk
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -ksp_gmres_restart -pc_type -sub_pc_type'
+  petsc_options_value = 'gmres 300 asm lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_rel_step_tol = 1e-12
+  nl_abs_step_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-8
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
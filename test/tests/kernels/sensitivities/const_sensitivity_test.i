@@ -0,0 +1,181 @@
+# Forward sensitivity of 2A <--> B with respect to the forward rate constant
+#
+#   The species are nonlinear variables, so the Jacobian of the sensitivity kernels
+#   with respect to the species (second derivatives of the reaction rate) is used.
+#
+#   dA/dt = -2*(kf*A^2 - kr*B)      dB/dt = kf*A^2 - kr*B
+#
+#   Gold values are the implicit Euler solution and its exact derivative with
+#   respect to kf.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+
+#Sensitivity variables
+  [./sA]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sB]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxn]  #   2A <--> B
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = -2.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxn]  #   2A <--> B
+    type = ConstReaction
+    variable = B
+    this_variable = B
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+#Sensitivity equations
+  [./sA_dot]
+    type = TimeDerivative
+    variable = sA
+  [../]
+  [./sA_rxn]
+    type = ConstReactionSensitivity
+    variable = sA
+    this_variable = A
+    sensitivity_parameter = forward_rate
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = -2.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sB_dot]
+    type = TimeDerivative
+    variable = sB
+  [../]
+  [./sB_rxn]
+    type = ConstReactionSensitivity
+    variable = sB
+    this_variable = B
+    sensitivity_parameter = forward_rate
+    forward_rate = 0.5
+    reverse_rate = 0.1
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '2'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+[]
+
+[Postprocessors]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./B]
+        type = ElementAverageValue
+        variable = B
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sA]
+        type = ElementAverageValue
+        variable = sA
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sB]
+        type = ElementAverageValue
+        variable = sB
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -ksp_gmres_restart -pc_type -sub_pc_type'
+  petsc_options_value = 'gmres 300 asm lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_rel_step_tol = 1e-12
+  nl_abs_step_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-8
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
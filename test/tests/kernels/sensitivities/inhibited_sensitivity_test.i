@@ -0,0 +1,276 @@
+# Forward sensitivity of A --> B with a Langmuir inhibition term and a rising temperature
+#
+#   dA/dt = -kf*A/R     R = 1 + K*A     dT/dt = 40
+#
+#   kf = Af*exp(-Ef/R/T)     K = AL*exp(-EL/R/T)
+#
+#   Temperature and the inhibition term are nonlinear variables, so the Jacobian of the
+#   sensitivity kernels with respect to the species, the inhibition, and temperature
+#   is used. The sensitivity is taken with respect to the forward activation energy
+#   (inhibited_sensitivity) or the Langmuir pre-exponential (langmuir_sensitivity),
+#   which is selected with the command line arguments in the tests file. Gold values
+#   are the implicit Euler solution and its exact derivative with respect to the parameter.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+#Inhibition variable
+  [./R]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+#Temperature variable
+  [./T]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 400
+  [../]
+
+#Sensitivity variables
+  [./sA]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sB]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sR]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./T_dot]
+    type = TimeDerivative
+    variable = T
+  [../]
+  [./T_ramp]
+    type = BodyForce
+    variable = T
+    value = 40.0
+  [../]
+
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxn]  #   A --> B
+    type = InhibitedArrheniusReaction
+    variable = A
+    this_variable = A
+    temperature = T
+    forward_inhibition = R
+
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxn]  #   A --> B
+    type = InhibitedArrheniusReaction
+    variable = B
+    this_variable = B
+    temperature = T
+    forward_inhibition = R
+
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./R_eq]
+    type = Reaction
+    variable = R
+  [../]
+  [./R_lang]
+    type = LangmuirInhibition
+    variable = R
+    temperature = T
+    coupled_list = 'A'
+    pre_exponentials = '0.5'
+    activation_energies = '-2000.0'
+  [../]
+
+#Sensitivity equations
+  [./sA_dot]
+    type = TimeDerivative
+    variable = sA
+  [../]
+  [./sA_rxn]
+    type = InhibitedArrheniusReactionSensitivity
+    variable = sA
+    this_variable = A
+    temperature = T
+    forward_inhibition = R
+    forward_inhibition_sensitivity = sR
+    sensitivity_parameter = forward_activation_energy
+
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sB_dot]
+    type = TimeDerivative
+    variable = sB
+  [../]
+  [./sB_rxn]
+    type = InhibitedArrheniusReactionSensitivity
+    variable = sB
+    this_variable = B
+    temperature = T
+    forward_inhibition = R
+    forward_inhibition_sensitivity = sR
+    sensitivity_parameter = forward_activation_energy
+
+    forward_pre_exponential = 50.0
+    forward_activation_energy = 10000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sR_eq]
+    type = Reaction
+    variable = sR
+  [../]
+  [./sR_lang]
+    type = LangmuirInhibitionSensitivity
+    variable = sR
+    temperature = T
+    coupled_list = 'A'
+    coupled_sensitivities = 'sA'
+    pre_exponentials = '0.5'
+    activation_energies = '-2000.0'
+    sensitivity_parameter = none
+  [../]
+[]
+
+[Postprocessors]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./B]
+        type = ElementAverageValue
+        variable = B
+        execute_on = 'initial timestep_end'
+    [../]
+    [./R]
+        type = ElementAverageValue
+        variable = R
+        execute_on = 'initial timestep_end'
+    [../]
+    [./T]
+        type = ElementAverageValue
+        variable = T
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sA]
+        type = ElementAverageValue
+        variable = sA
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sB]
+        type = ElementAverageValue
+        variable = sB
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sR]
+        type = ElementAverageValue
+        variable = sR
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = newton
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -ksp_gmres_restart -pc_type -sub_pc_type'
+  petsc_options_value = 'gmres 300 asm lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_rel_step_tol = 1e-12
+  nl_abs_step_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-8
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
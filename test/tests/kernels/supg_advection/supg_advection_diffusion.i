@@ -0,0 +1,95 @@
+# Steady 1D advection-diffusion with continuous Galerkin and SUPG stabilization
+#
+#     v * du/dx - D * d^2u/dx^2 = 0,  u(0) = 0,  u(1) = 1
+#
+#   With the optimal stabilization parameter the nodal values are exact:
+#     u(x) = (exp(v*x/D) - 1) / (exp(v/D) - 1)
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+  xmin = 0.0
+  xmax = 1.0
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./vel_x]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1.0
+  [../]
+  [./D]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.05
+  [../]
+[]
+
+[Kernels]
+  [./u_adv]
+    type = SUPGConcentrationAdvection
+    variable = u
+    ux = vel_x
+    uy = 0
+    uz = 0
+    diffusivity = D
+  [../]
+  [./u_diff]
+    type = GVariableDiffusion
+    variable = u
+    Dx = D
+    Dy = D
+    Dz = D
+  [../]
+[]
+
+[BCs]
+  [./u_left]
+    type = DirichletBC
+    variable = u
+    boundary = 'left'
+    value = 0
+  [../]
+  [./u_right]
+    type = DirichletBC
+    variable = u
+    boundary = 'right'
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_mid]
+    type = PointValue
+    variable = u
+    point = '0.5 0 0'
+    execute_on = 'timestep_end'
+  [../]
+  [./u_end]
+    type = PointValue
+    variable = u
+    point = '0.9 0 0'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = newton
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,153 @@
+# Conversion of A (solved in w = ln(A)) to B (solved in B) over one large time step:
+#
+#     dA/dt = -kf*A,   dB/dt = kf*A
+#
+# The change in w over the step is about 2, so the time derivative must use the change
+#   in concentration over the step to conserve the total mass (A + B = 1). Implicit Euler
+#   gives A = 1/(1 + dt*kf) and B = dt*kf/(1 + dt*kf)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./w]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./eps]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./temp]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 300
+  [../]
+[]
+
+[Kernels]
+  [./w_dot]
+    type = TransformedVariableCoefTimeDerivative
+    variable = w
+    coupled_coef = eps
+  [../]
+  [./w_rxn]
+    type = TransformedArrheniusReaction
+    variable = w
+    this_variable = w
+    transformed_species = w
+    forward_pre_exponential = 6.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    temperature = temp
+    scale = -1.0
+    reactants = 'w'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+  [./B_dot]
+    type = VariableCoefTimeDerivative
+    variable = B
+    coupled_coef = eps
+  [../]
+  [./B_rxn]
+    type = TransformedArrheniusReaction
+    variable = B
+    this_variable = B
+    transformed_species = w
+    forward_pre_exponential = 6.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    temperature = temp
+    scale = 1.0
+    reactants = 'w'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[AuxKernels]
+  [./A]
+    type = AuxTransformedConcentration
+    variable = A
+    transformed_variable = w
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./total]
+    type = LinearCombinationPostprocessor
+    pp_names = 'A B'
+    pp_coefs = '1 1'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 20
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 1.0
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 1.0
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,220 @@
+# Fast first order decay of a species over seven orders of magnitude, solved in the log of
+#   its concentration (w = ln(C)) and in the asinh of its concentration (v = asinh(C/1e-6),
+#   C_v = 1e-6*sinh(v)) with the transformed advection and diffusion kernels:
+#
+#     eps * dC/dt + div(eps*v*C) - div(eps*D*grad(C)) = -kf*C
+#
+# Implicit Euler in C gives C_n = (1 + dt*kf/eps)^-n = 63.5^-n exactly for both transformations
+#   (i.e., w_n = -n*ln(63.5)), which stays positive and accurate down to C ~ 6e-8
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./w]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./v]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 14.50865773852447
+  [../]
+[]
+
+[AuxVariables]
+  [./C]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./C_v]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+  [./eps]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.5
+  [../]
+  [./vel]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./D]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.1
+  [../]
+  [./temp]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 300
+  [../]
+[]
+
+[Kernels]
+  [./w_dot]
+    type = TransformedVariableCoefTimeDerivative
+    variable = w
+    coupled_coef = eps
+  [../]
+  [./w_gadv]
+    type = TransformedGPoreConcAdvection
+    variable = w
+    porosity = eps
+    ux = vel
+    uy = vel
+    uz = vel
+  [../]
+  [./w_gdiff]
+    type = TransformedGVarPoreDiffusion
+    variable = w
+    porosity = eps
+    Dx = D
+    Dy = D
+    Dz = D
+  [../]
+  [./w_rxn]
+    type = TransformedArrheniusReaction
+    variable = w
+    this_variable = w
+    transformed_species = w
+    forward_pre_exponential = 125.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    temperature = temp
+    scale = -1.0
+    reactants = 'w'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+  [./v_dot]
+    type = TransformedVariableCoefTimeDerivative
+    variable = v
+    transform = asinh
+    transform_scale = 1e-6
+    coupled_coef = eps
+  [../]
+  [./v_gadv]
+    type = TransformedGPoreConcAdvection
+    variable = v
+    transform = asinh
+    transform_scale = 1e-6
+    porosity = eps
+    ux = vel
+    uy = vel
+    uz = vel
+  [../]
+  [./v_gdiff]
+    type = TransformedGVarPoreDiffusion
+    variable = v
+    transform = asinh
+    transform_scale = 1e-6
+    porosity = eps
+    Dx = D
+    Dy = D
+    Dz = D
+  [../]
+  [./v_rxn]
+    type = TransformedArrheniusReaction
+    variable = v
+    transform = asinh
+    transform_scale = 1e-6
+    this_variable = v
+    transformed_species = v
+    forward_pre_exponential = 125.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    temperature = temp
+    scale = -1.0
+    reactants = 'v'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[AuxKernels]
+  [./C]
+    type = AuxTransformedConcentration
+    variable = C
+    transformed_variable = w
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C_v]
+    type = AuxTransformedConcentration
+    variable = C_v
+    transformed_variable = v
+    transform = asinh
+    transform_scale = 1e-6
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Postprocessors]
+  [./w]
+    type = ElementAverageValue
+    variable = w
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'initial timestep_end'
+  [../]
+  [./v]
+    type = ElementAverageValue
+    variable = v
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C_v]
+    type = ElementAverageValue
+    variable = C_v
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
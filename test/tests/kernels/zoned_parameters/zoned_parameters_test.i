@@ -0,0 +1,151 @@
+# First order decay (dA/dt = -k*A) and transfer (dB/dt = -k*B) in a two zone catalyst
+#   with one kernel each for all zones. Each zone has its own rate constant:
+#
+#   front: k_A = 1, k_B = 2
+#   rear:  k_A = 3, k_B = 0.5
+#
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 1
+    xmin = 0
+    xmax = 2
+  [../]
+  [./front]
+    input = gen
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '0 0 0'
+    top_right = '1 1 0'
+    block_id = 1
+    block_name = front
+  [../]
+  [./rear]
+    input = front
+    type = SubdomainBoundingBoxGenerator
+    bottom_left = '1 0 0'
+    top_right = '2 1 0'
+    block_id = 2
+    block_name = rear
+  [../]
+[]
+
+[Variables]
+  [./A]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+  [./B]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./B_eq]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_decay]
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 0.0
+    reverse_rate = 0.0
+    zones = 'front rear'
+    zone_forward_rate = '1.0 3.0'
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_trans]
+    type = ConstMassTransfer
+    variable = B
+    coupled = B_eq
+    transfer_rate = 0.0
+    zones = 'front rear'
+    zone_transfer_rate = '2.0 0.5'
+  [../]
+[]
+
+[Postprocessors]
+  [./A_front]
+    type = ElementAverageValue
+    variable = A
+    block = front
+    execute_on = 'initial timestep_end'
+  [../]
+  [./A_rear]
+    type = ElementAverageValue
+    variable = A
+    block = rear
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B_front]
+    type = ElementAverageValue
+    variable = B
+    block = front
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B_rear]
+    type = ElementAverageValue
+    variable = B
+    block = rear
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,110 @@
+# Steady 1D pore diffusion with the MOOSE interior penalty HDG kernels, where
+#   the element unknowns are statically condensed and only the face (trace)
+#   unknowns are in the global system. The effective diffusivity (porosity * D)
+#   comes from the CATS variables through PoreTransportHDGMaterial.
+#
+#     -d/dx(eps * D * du/dx) = 0,  u(0) = 0,  u(1) = 1  ->  u(x) = x
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 8
+  xmin = 0.0
+  xmax = 1.0
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = MONOMIAL
+  [../]
+  [./u_face]
+    order = FIRST
+    family = SIDE_HIERARCHIC
+  [../]
+[]
+
+[AuxVariables]
+  [./eps]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0.4
+  [../]
+  [./D]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0.1
+  [../]
+[]
+
+[HDGKernels]
+  [./u_diff]
+    type = DiffusionIPHDGKernel
+    variable = u
+    face_variable = u_face
+    diffusivity = diffusivity
+    alpha = 6
+  [../]
+[]
+
+[BCs]
+  [./u_left]
+    type = DiffusionIPHDGDirichletBC
+    variable = u
+    face_variable = u_face
+    diffusivity = diffusivity
+    alpha = 6
+    boundary = 'left'
+    functor = 0
+  [../]
+  [./u_right]
+    type = DiffusionIPHDGDirichletBC
+    variable = u
+    face_variable = u_face
+    diffusivity = diffusivity
+    alpha = 6
+    boundary = 'right'
+    functor = 1
+  [../]
+[]
+
+[Materials]
+  [./pore_transport]
+    type = PoreTransportHDGMaterial
+    porosity = eps
+    diffusivity = D
+  [../]
+[]
+
+[Postprocessors]
+  [./u_avg]
+    type = ElementAverageValue
+    variable = u
+    execute_on = 'timestep_end'
+  [../]
+  [./u_point]
+    type = PointValue
+    variable = u
+    point = '0.3 0 0'
+    execute_on = 'timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./sc]
+    type = StaticCondensation
+    petsc_options_iname = '-pc_type'
+    petsc_options_value = 'lu'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = newton
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
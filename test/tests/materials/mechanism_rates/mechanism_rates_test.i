@@ -0,0 +1,135 @@
+# Two parallel first order reactions (A -> B and A -> C) read from a mechanism file
+#   (k1 = 1 and k2 = 0.5, so dA/dt = -1.5*A, dB/dt = A and dC/dt = 0.5*A)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./C]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 500
+  [../]
+[]
+
+[Materials]
+  [./mechanism]
+    type = MechanismReactionRates
+    mechanism_file = mechanism.txt
+    species = 'A B C'
+    temperature = T
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxns]
+    type = ReactionRateSum
+    variable = A
+    rate_names = 'r1 r2'
+    weights = '-1 -1'
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxns]
+    type = ReactionRateSum
+    variable = B
+    rate_names = 'r1'
+    weights = '1'
+    coupled_variables = 'A'
+  [../]
+  [./C_dot]
+    type = TimeDerivative
+    variable = C
+  [../]
+  [./C_rxns]
+    type = ReactionRateSum
+    variable = C
+    rate_names = 'r2'
+    weights = '1'
+    coupled_variables = 'A'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,112 @@
+# First order decay of A (k = 1) with a fast adsorption equilibrium (A + S <-- --> q)
+#   solved locally (K = 1, Smax = 1, so q = A/(1 + A) and d(A + q)/dt = -A)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 500
+  [../]
+[]
+
+[Materials]
+  [./adsorption]
+    type = QuasiEquilibriumAdsorption
+    species = 'A'
+    adsorbed_names = 'q'
+    enthalpies = '0'
+    entropies = '0'
+    max_capacity = 1
+    temperature = T
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./q_dot]
+    type = QuasiEquilibriumTimeDerivative
+    variable = A
+    adsorbed_name = q
+  [../]
+  [./first_order_decay]
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./q]
+    type = ElementAverageMaterialProperty
+    mat_prop = q
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
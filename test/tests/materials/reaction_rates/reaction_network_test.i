@@ -0,0 +1,191 @@
+# Small reaction network assembled from several rate material properties
+#   r1:  A + B <-> C   (ConstReactionRate, kf = 2, kr = 0.5)
+#   r2:  C -> D        (ArrheniusReactionRate, k = 0.002 * T at T = 500 K)
+#   r3:  2A -> D       (ConstReactionRate, kf = 0.3)
+#
+#   dA/dt = -r1 - 2*r3,  dB/dt = -r1,  dC/dt = r1 - r2,  dD/dt = r2 + r3
+#
+# Each species sums a different subset of the rates with its own weights, so the
+#   off-diagonal Jacobian terms come from rates that depend on several variables.
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0.5
+  [../]
+  [./C]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./D]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./T]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 500
+  [../]
+[]
+
+[Materials]
+  [./r1]
+    type = ConstReactionRate
+    rate_name = r1
+    forward_rate = 2
+    reverse_rate = 0.5
+    reactants = 'A B'
+    reactant_stoich = '1 1'
+    products = 'C'
+    product_stoich = '1'
+  [../]
+  [./r2]
+    type = ArrheniusReactionRate
+    rate_name = r2
+    forward_pre_exponential = 0.002
+    forward_beta = 1
+    forward_activation_energy = 0
+    reverse_pre_exponential = 0
+    temperature = T
+    reactants = 'C'
+    reactant_stoich = '1'
+    products = 'D'
+    product_stoich = '1'
+  [../]
+  [./r3]
+    type = ConstReactionRate
+    rate_name = r3
+    forward_rate = 0.3
+    reverse_rate = 0
+    reactants = 'A'
+    reactant_stoich = '2'
+    products = 'D'
+    product_stoich = '1'
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_rxns]
+    type = ReactionRateSum
+    variable = A
+    rate_names = 'r1 r3'
+    weights = '-1 -2'
+    coupled_variables = 'B C'
+  [../]
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_rxns]
+    type = ReactionRateSum
+    variable = B
+    rate_names = 'r1'
+    weights = '-1'
+    coupled_variables = 'A C'
+  [../]
+  [./C_dot]
+    type = TimeDerivative
+    variable = C
+  [../]
+  [./C_rxns]
+    type = ReactionRateSum
+    variable = C
+    rate_names = 'r1 r2'
+    weights = '1 -1'
+    coupled_variables = 'A B'
+  [../]
+  [./D_dot]
+    type = TimeDerivative
+    variable = D
+  [../]
+  [./D_rxns]
+    type = ReactionRateSum
+    variable = D
+    rate_names = 'r2 r3'
+    weights = '1 1'
+    coupled_variables = 'A C'
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'initial timestep_end'
+  [../]
+  [./D]
+    type = ElementAverageValue
+    variable = D
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,83 @@
+# Direct read of a UNV file as exported by Gmsh (without unv-converter.py)
+#
+#   The file uses fe id 21 for the boundary edges, the 2477 tag for the groups,
+#   and has a group of nodes (corner), which all had to be converted before.
+#   The solution of the diffusion problem is u = x/2.
+
+[Mesh]
+  [./gmsh_file]
+    type = GmshUNVMeshGenerator
+    file = two_quad_gmsh.unv
+  [../]
+  #The above file contains the following block and boundary names
+  #boundary_name = 'left right corner'
+  #block_name = 'domain'
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+    block = 'domain'
+  [../]
+[]
+
+[Kernels]
+  [./u_diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./u_left]
+    type = DirichletBC
+    variable = u
+    boundary = 'left'
+    value = 0
+  [../]
+  [./u_right]
+    type = DirichletBC
+    variable = u
+    boundary = 'right'
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+    [./area]
+        type = VolumePostprocessor
+        block = 'domain'
+        execute_on = 'timestep_end'
+    [../]
+    [./right_length]
+        type = AreaPostprocessor
+        boundary = 'right'
+        execute_on = 'timestep_end'
+    [../]
+    [./corner_u]
+        type = NodalSum
+        variable = u
+        boundary = 'corner'
+        execute_on = 'timestep_end'
+    [../]
+    [./u_avg]
+        type = ElementAverageValue
+        variable = u
+        execute_on = 'timestep_end'
+    [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = pjfnk
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,195 @@
+# Surface reactions evaluated at the nodes with an inhibition term
+#   and a Langmuir isotherm:
+#
+#     dA/dt = -A/R
+#     dB/dt =  A/R
+#     dC/dt =  0.5*A
+#         R =  1 + A
+#         q =  2*A/(1 + A)
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./C]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 0
+  [../]
+  [./R]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 2
+  [../]
+  [./q]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./temp]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 300
+  [../]
+[]
+
+[NodalKernels]
+  [./A_dot]
+    type = TimeDerivativeNodalKernel
+    variable = A
+  [../]
+  [./A_rxn]
+    type = NodalInhibitedArrheniusReaction
+    variable = A
+    forward_pre_exponential = 1.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    forward_inhibition = R
+    temperature = temp
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./B_dot]
+    type = TimeDerivativeNodalKernel
+    variable = B
+  [../]
+  [./B_rxn]
+    type = NodalInhibitedArrheniusReaction
+    variable = B
+    forward_pre_exponential = 1.0
+    forward_activation_energy = 0.0
+    reverse_pre_exponential = 0.0
+    forward_inhibition = R
+    temperature = temp
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+  [./C_dot]
+    type = TimeDerivativeNodalKernel
+    variable = C
+  [../]
+  [./C_rxn]
+    type = NodalConstReaction
+    variable = C
+    forward_rate = 0.5
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+  [./R_eq]
+    type = ReactionNodalKernel
+    variable = R
+  [../]
+  [./R_lang]
+    type = NodalLangmuirInhibition
+    variable = R
+    coupled_list = 'A'
+    pre_exponentials = '1'
+    temperature = temp
+  [../]
+  [./q_eq]
+    type = ReactionNodalKernel
+    variable = q
+  [../]
+  [./q_lang]
+    type = NodalExtendedLangmuirModel
+    variable = q
+    site_density = 2
+    main_coupled = A
+    coupled_list = 'A'
+    enthalpies = '0'
+    entropies = '0'
+    coupled_temp = temp
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./B]
+    type = ElementAverageValue
+    variable = B
+    execute_on = 'initial timestep_end'
+  [../]
+  [./C]
+    type = ElementAverageValue
+    variable = C
+    execute_on = 'initial timestep_end'
+  [../]
+  [./R]
+    type = ElementAverageValue
+    variable = R
+    execute_on = 'initial timestep_end'
+  [../]
+  [./q]
+    type = ElementAverageValue
+    variable = q
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
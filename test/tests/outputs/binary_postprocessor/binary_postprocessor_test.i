@@ -0,0 +1,91 @@
+# Decay of A (A --> B, k = 1) with the postprocessors written both to the usual CSV file
+#   and to the binary time series, which is read back and compared with the CSV file
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+     type = TimeDerivative
+     variable = A
+  [../]
+  [./first_order_decay]  #   A --> B
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[Postprocessors]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./A_max]
+        type = ElementExtremeValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+  [./out]
+    type = BinaryPostprocessorOutput
+    postprocessors = 'A A_max'
+  [../]
+[] #END Outputs
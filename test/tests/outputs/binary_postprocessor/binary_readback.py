@@ -0,0 +1,24 @@
+'''
+    Reads the binary time series written by binary_postprocessor_test.i back
+    with the python reader and checks it against the CSV file of the same run.
+'''
+import os, sys
+import unittest
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                             '..', '..', '..', '..', 'scripts', 'python',
+                             'input_output_processing'))
+from read_moose_binary_to_df import *
+
+class TestBinaryReadback(unittest.TestCase):
+    def test_binary_matches_csv(self):
+        binary = MOOSE_Binary_File('binary_postprocessor_test_out.bin')
+        csv = MOOSE_CVS_File('binary_postprocessor_test_out.csv')
+        self.assertEqual(binary.num_rows, csv.num_rows)
+        self.assertEqual(sorted(binary.valid_col_names), sorted(csv.valid_col_names))
+        for c in csv.valid_col_names:
+            for i in range(csv.num_rows):
+                self.assertAlmostEqual(binary.df[c][i], csv.df[c][i], delta=1e-12*(1+abs(csv.df[c][i])))
+
+if __name__ == '__main__':
+    unittest.main()
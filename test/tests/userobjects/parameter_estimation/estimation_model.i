@@ -0,0 +1,261 @@
+# Model for the estimation of the forward pre-exponential factor for A --> B (run by
+#   estimation_test.i)
+#
+#   The sensitivity variables (sA = dA/dAf, sB = dB/dAf) are solved with the species
+#   and the LeastSquaresParameterEstimator builds the least-squares objective and the
+#   damped Gauss-Newton update in the same run. The current value of the parameter
+#   (Af) is received from the parent app and applied to the kernels by a Control,
+#   and the next guess for the fit (Af_new) is sent back to the parent app.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 1
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 1
+  [../]
+  [./B]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+
+#Sensitivity variables
+  [./sA]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+  [./sB]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[AuxVariables]
+  [./temp]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 400  #K
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_loss]  #   A --> B
+    type = ArrheniusReaction
+    variable = A
+    this_variable = A
+    temperature = temp
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_gain]  #   A --> B
+    type = ArrheniusReaction
+    variable = B
+    this_variable = B
+    temperature = temp
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+#Sensitivity equations
+  [./sA_dot]
+    type = TimeDerivative
+    variable = sA
+  [../]
+  [./sA_loss]
+    type = ArrheniusReactionSensitivity
+    variable = sA
+    this_variable = A
+    temperature = temp
+    sensitivity_parameter = forward_pre_exponential
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+
+  [./sB_dot]
+    type = TimeDerivative
+    variable = sB
+  [../]
+  [./sB_gain]
+    type = ArrheniusReactionSensitivity
+    variable = sB
+    this_variable = B
+    temperature = temp
+    sensitivity_parameter = forward_pre_exponential
+
+    forward_pre_exponential = 2.0
+    forward_activation_energy = 5000.0
+    reverse_pre_exponential = 0.0
+
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    reactant_sensitivities = 'sA'
+    products = 'B'
+    product_stoich = '1'
+    product_sensitivities = 'sB'
+  [../]
+[]
+
+[BCs]
+
+[]
+
+[UserObjects]
+  [./estimator]
+    type = LeastSquaresParameterEstimator
+    data_file = 'A_data.csv'
+    time_column = 'time'
+    data_columns = 'A'
+    model_values = 'A'
+    sensitivities = 'sA'
+    parameter_names = 'Af'
+    parameter_values = 'Af'
+    damping = 1e-3
+    max_step = 0.5
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Functions]
+  [./Af_func]
+    type = ParsedFunction
+    expression = 'Af'
+    symbol_names = 'Af'
+    symbol_values = 'Af'
+  [../]
+[]
+
+[Controls]
+  [./Af_control]
+    type = RealFunctionControl
+    parameter = 'Kernels/*/forward_pre_exponential'
+    function = 'Af_func'
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Postprocessors]
+    [./Af]
+        type = Receiver
+        default = 2.0
+    [../]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./sA]
+        type = ElementAverageValue
+        variable = sA
+        execute_on = 'initial timestep_end'
+    [../]
+    [./objective]
+        type = ParameterEstimateValue
+        estimator = estimator
+        quantity = objective
+        execute_on = 'initial timestep_end'
+    [../]
+    [./grad_Af]
+        type = ParameterEstimateValue
+        estimator = estimator
+        quantity = gradient
+        parameter = Af
+        execute_on = 'initial timestep_end'
+    [../]
+    [./Af_update]
+        type = ParameterEstimateValue
+        estimator = estimator
+        quantity = update
+        parameter = Af
+        execute_on = 'initial timestep_end'
+    [../]
+    [./Af_new]
+        type = ParameterEstimateValue
+        estimator = estimator
+        quantity = updated_value
+        parameter = Af
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-14
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 2.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = false
+  exodus = false
+  csv = false
+[] #END Outputs
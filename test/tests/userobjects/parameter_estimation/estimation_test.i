@@ -0,0 +1,77 @@
+# Estimation of the forward pre-exponential factor for A --> B from data
+#
+#   The data in A_data.csv were generated by the model (implicit-euler, dt = 0.25)
+#   with forward_pre_exponential = 2.5, so the least-squares optimum is known
+#   (Af = 2.5, objective = 0). The fit starts at Af = 2.0 and is iterated in this
+#   run: each fixed point iteration solves the full transient of estimation_model.i
+#   from its initial state with the current Af, and the damped Gauss-Newton update
+#   (Af_new) becomes the next Af until Af stops changing.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[MultiApps]
+  [./model]
+    type = FullSolveMultiApp
+    input_files = 'estimation_model.i'
+    execute_on = 'timestep_begin'
+  [../]
+[]
+
+[Transfers]
+  [./to_model]
+    type = MultiAppPostprocessorTransfer
+    to_multi_app = model
+    from_postprocessor = Af
+    to_postprocessor = Af
+  [../]
+  [./Af_from_model]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = model
+    from_postprocessor = Af_new
+    to_postprocessor = Af
+    reduction_type = average
+  [../]
+  [./objective_from_model]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = model
+    from_postprocessor = objective
+    to_postprocessor = objective
+    reduction_type = average
+  [../]
+[]
+
+[Postprocessors]
+    [./Af]
+        type = Receiver
+        default = 2.0
+    [../]
+    [./objective]
+        type = Receiver
+        default = 0.0
+    [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Iterate the fit until the parameter stops changing (there is no residual in this app)
+  fixed_point_max_its = 20
+  disable_fixed_point_residual_norm_check = true
+  custom_pp = Af
+  custom_rel_tol = 1e-10
+  custom_abs_tol = 1e-12
+[] #END Executioner
+
+[Outputs]
+  exodus = false
+  csv = true
+[] #END Outputs
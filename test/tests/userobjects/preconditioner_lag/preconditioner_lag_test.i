@@ -0,0 +1,105 @@
+# First order decay (dA/dt = -A) with the preconditioner and Jacobian reused
+#   between time steps and rebuilt at t = 0.5. The number of Jacobian assemblies
+#   (jacobians) only increases on the first step and at t = 0.5, and on every step
+#   when the rebuild is forced with max_lag_steps = 1.
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    initial_condition = 1
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./first_order_decay]
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = ''
+    product_stoich = ''
+  [../]
+[]
+
+[UserObjects]
+  [./pc_lag]
+    type = PreconditionerLagController
+    max_linear_iterations = 10
+    max_nonlinear_iterations = 4
+    rebuild_times = '0.5'
+    lag_jacobian = true
+  [../]
+[]
+
+[Postprocessors]
+  [./A]
+    type = ElementAverageValue
+    variable = A
+    execute_on = 'initial timestep_end'
+  [../]
+  [./jacobians]
+    type = PerfGraphData
+    section_name = 'FEProblem::computeJacobianInternal'
+    data_type = CALLS
+    must_exist = false
+    execute_on = 'initial timestep_end'
+  [../]
+  [./nl_its]
+    type = NumNonlinearIterations
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+    solve_type = newton
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -pc_type'
+  petsc_options_value = 'gmres lu'
+
+  line_search = none
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-12
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.0
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs
@@ -0,0 +1,139 @@
+# Warm start from a library of pre-equilibrated states
+#
+#   The first run (save) goes through the whole protocol (A --> B, with a
+#   nodal A = 1 + x initially and an elemental B) from a cold start and
+#   stores the states at the end of each stage (t = 0.5 and t = 1). The
+#   other runs use the same protocol and parameters, but start (start_time)
+#   at the end of a stage, so they load the stored state of that stage and
+#   skip the stages before it. The loaded runs must reproduce the cold run
+#   from their start time onwards.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./A]
+    order = FIRST
+    family = LAGRANGE
+    [./InitialCondition]
+      type = FunctionIC
+      function = '1 + x'
+    [../]
+  [../]
+  [./B]
+    order = FIRST
+    family = MONOMIAL
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./A_dot]
+    type = TimeDerivative
+    variable = A
+  [../]
+  [./A_loss]  #   A --> B
+    type = ConstReaction
+    variable = A
+    this_variable = A
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = -1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+
+  [./B_dot]
+    type = TimeDerivative
+    variable = B
+  [../]
+  [./B_gain]  #   A --> B
+    type = ConstReaction
+    variable = B
+    this_variable = B
+    forward_rate = 1.0
+    reverse_rate = 0.0
+    scale = 1.0
+    reactants = 'A'
+    reactant_stoich = '1'
+    products = 'B'
+    product_stoich = '1'
+  [../]
+[]
+
+[BCs]
+
+[]
+
+[UserObjects]
+  [./warm_start]
+    type = WarmStartLibrary
+    library_directory = 'warm_start_library'
+    protocol_name = 'A_to_B'
+    stage_times = '0.5 1.0'
+    stage_parameters = '1.0'
+  [../]
+[]
+
+[Postprocessors]
+    [./A]
+        type = ElementAverageValue
+        variable = A
+        execute_on = 'initial timestep_end'
+    [../]
+    [./B]
+        type = ElementAverageValue
+        variable = B
+        execute_on = 'initial timestep_end'
+    [../]
+    [./A_corner]
+        type = PointValue
+        variable = A
+        point = '1 1 0'
+        execute_on = 'initial timestep_end'
+    [../]
+[]
+
+[Preconditioning]
+  [./SMP_PJFNK]
+    type = SMP
+    full = true
+  [../]
+[] #END Preconditioning
+
+[Executioner]
+  type = Transient
+  scheme = implicit-euler
+  solve_type = pjfnk
+  petsc_options = '-snes_converged_reason'
+  petsc_options_iname ='-ksp_type -ksp_gmres_restart -pc_type -sub_pc_type'
+  petsc_options_value = 'gmres 300 asm lu'
+
+  line_search = none
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  nl_max_its = 10
+  l_tol = 1e-8
+  l_max_its = 300
+
+  start_time = 0.0
+  end_time = 1.5
+  dtmax = 0.25
+
+  [./TimeStepper]
+     type = ConstantDT
+     dt = 0.25
+  [../]
+[] #END Executioner
+
+[Outputs]
+  print_linear_residuals = true
+  exodus = false
+  csv = true
+[] #END Outputs